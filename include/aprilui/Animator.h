@@ -84,11 +84,11 @@ namespace aprilui
 		/// @note Does not reset delay.
 		void reset();
 
+		int64_t getByteSize() const;
+
 		hstr getProperty(chstr name);
 		bool setProperty(chstr name, chstr value);
 
-		void notifyEvent(chstr type, EventArgs* args);
-
 	protected:
 		float timeDelta;
 		float value;
@@ -124,6 +124,7 @@ namespace aprilui
 
 		virtual float _getObjectValue() const = 0;
 		virtual void _setObjectValue(float value) = 0;
+		void _notifyEvent(int typeId, EventArgs* args);
 
 	private:
 		static hmap<hstr, PropertyDescription> _propertyDescriptions;
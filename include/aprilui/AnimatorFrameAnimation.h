@@ -39,8 +39,6 @@ namespace aprilui
 
 			bool setProperty(chstr name, chstr value);
 
-			void notifyEvent(chstr type, EventArgs* args);
-			
 		protected:
 			hstr imageBaseName;
 			int firstFrame;
@@ -53,6 +51,7 @@ namespace aprilui
 			inline void _setObjectValue(float value) { }
 
 			void _update(float timeDelta);
+			void _notifyEvent(int typeId, EventArgs* args);
 
 		private:
 			static hmap<hstr, PropertyDescription> _propertyDescriptions;
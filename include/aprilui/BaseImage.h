@@ -60,6 +60,10 @@ namespace aprilui
 		void setClipSize(cgvec2f value);
 		void setClipSize(const float& w, const float& h);
 		hstr getFullName() const;
+		/// @return Approximate CPU memory used by this image in bytes, not including its caches.
+		virtual int64_t getByteSize() const;
+		/// @return Approximate CPU memory used by cached vertices and texture coordinates of this image in bytes.
+		virtual int64_t getCacheByteSize() const;
 
 		virtual gvec2f getSrcSize() const = 0;
 		virtual void setSrcSize(cgvec2f value) = 0;
@@ -75,6 +79,12 @@ namespace aprilui
 
 		virtual void draw(cgrectf rect, const april::Color& color = april::Color::White) = 0;
 		virtual void draw(const harray<april::TexturedVertex>& vertices, const april::Color& color = april::Color::White) = 0;
+		/// @brief Draws the image with a clip rect that is used instead of the image's own clip rect.
+		/// @param[in] rect The destination rect.
+		/// @param[in] clipRect The clip rect in the image's source coordinates.
+		/// @param[in] color The color.
+		/// @note Image types that don't support this directly fall back to temporarily changing the clip rect. Images derived from MinimalImage don't change their state.
+		virtual void drawClipped(cgrectf rect, cgrectf clipRect, const april::Color& color = april::Color::White);
 
 		static harray<Texture*> findTextures(harray<BaseImage*> baseImages);
 
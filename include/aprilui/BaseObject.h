@@ -14,7 +14,10 @@
 #define APRILUI_BASE_OBJECT_H
 
 #include <april/Keys.h>
+#include <april/Color.h>
+#include <gtypes/Rectangle.h>
 #include <gtypes/Vector2.h>
+#include <gtypes/Vector3.h>
 #include <hltypes/harray.h>
 #include <hltypes/hmap.h>
 #include <hltypes/hstring.h>
@@ -46,6 +49,10 @@ namespace aprilui
 		virtual hmap<hstr, PropertyDescription>& getPropertyDescriptions() const;
 
 		HL_DEFINE_GET(hstr, name, Name);
+		/// @return The interned ID of the name.
+		/// @note The name is interned on the first call only so objects that are never looked up by ID don't grow the global name table.
+		/// @see aprilui::internName()
+		int getNameId();
 		void setName(chstr value);
 		HL_DEFINE_GETSET(hstr, tag, Tag);
 		hstr getFullName() const;
@@ -72,10 +79,62 @@ namespace aprilui
 		harray<Object*> getAncestors() const;
 		harray<BaseObject*> getDescendants() const;
 		harray<Object*> getDescendantObjects() const;
+		/// @brief Callback for visiting objects in a tree.
+		/// @return False to skip the descendants of the visited object. The value is ignored in post-order traversal.
+		typedef bool (*Visitor)(BaseObject* object, void* userData);
+		/// @brief Visits all descendants of this object without allocating any arrays.
+		/// @param[in] visitor Called for every descendant.
+		/// @param[in] userData Passed to every call of the visitor.
+		/// @param[in] postOrder Whether the descendants of an object are visited before the object itself.
+		/// @note The visitor must not change the children of objects that are still being traversed. In post-order traversal the visited object
+		/// itself may be destroyed since the traversal is already done with it.
+		void visitDescendants(Visitor visitor, void* userData = NULL, bool postOrder = false) const;
+		/// @brief Visits all descendants of a specific type without allocating any arrays.
+		/// @note Descendants of objects that are not of the given type are still traversed.
+		/// @see visitDescendants()
+		template <typename T>
+		inline void visitDescendantsByType(bool (*visitor)(T* object, void* userData), void* userData = NULL, bool postOrder = false) const
+		{
+			TypedVisitor<T> typedVisitor(visitor, userData);
+			this->visitDescendants(&TypedVisitor<T>::visit, &typedVisitor, postOrder);
+		}
+		/// @brief Subscribes this object to an event type that is broadcast by Dataset::notifyEvent().
+		/// @param[in] type The event type.
+		/// @note With subscribed broadcasting, broadcasts only reach objects that are subscribed to their event type so they don't have to visit every object.
+		/// @see Dataset::setSubscribedBroadcasting()
+		void subscribeBroadcast(chstr type);
+		void unsubscribeBroadcast(chstr type);
+		bool isSubscribedToBroadcast(chstr type) const;
+		/// @return Approximate CPU memory used by this object in bytes, not including its children.
+		virtual int64_t getByteSize() const;
 
 		virtual hstr getProperty(chstr name);
 		virtual bool setProperty(chstr name, chstr value);
 		bool hasProperty(chstr name);
+		/// @brief Gets a property value by property ID without going through string conversion.
+		/// @param[in] propertyId The property ID obtained from PropertyDescription::findId().
+		/// @param[out] value The property value.
+		/// @return True if the property value was retrieved.
+		/// @note Properties that can't be accessed directly with the given value type fall back to getProperty().
+		bool getPropertyValue(int propertyId, int& value);
+		bool getPropertyValue(int propertyId, float& value);
+		bool getPropertyValue(int propertyId, bool& value);
+		bool getPropertyValue(int propertyId, gvec2f& value);
+		bool getPropertyValue(int propertyId, gvec3f& value);
+		bool getPropertyValue(int propertyId, grectf& value);
+		bool getPropertyValue(int propertyId, april::Color& value);
+		/// @brief Sets a property value by property ID without going through string conversion.
+		/// @param[in] propertyId The property ID obtained from PropertyDescription::findId().
+		/// @param[in] value The new property value.
+		/// @return True if the property value was set.
+		/// @note Properties that can't be accessed directly with the given value type fall back to setProperty().
+		bool setPropertyValue(int propertyId, const int& value);
+		bool setPropertyValue(int propertyId, const float& value);
+		bool setPropertyValue(int propertyId, const bool& value);
+		bool setPropertyValue(int propertyId, cgvec2f value);
+		bool setPropertyValue(int propertyId, const gvec3f& value);
+		bool setPropertyValue(int propertyId, cgrectf value);
+		bool setPropertyValue(int propertyId, const april::Color& value);
 
 		virtual void update(float timeDelta);
 
@@ -89,12 +148,15 @@ namespace aprilui
 		bool isAncestor(BaseObject* object);
 		BaseObject* findChildByName(chstr name);
 		BaseObject* findDescendantByName(chstr name);
+		BaseObject* findChildByNameId(int nameId);
+		BaseObject* findDescendantByNameId(int nameId);
 
 		void applyStyle(Style* value);
 		void applyStyleByName(chstr name);
 
 	protected:
 		hstr name;
+		int nameId; // 0 until the name is interned
 		hstr tag;
 		Object* parent; // a BaseObject cannot be a parent
 		harray<Object*> childrenObjects;
@@ -109,11 +171,61 @@ namespace aprilui
 		virtual void _update(float timeDelta);
 
 		void _sortChildren();
+		/// @brief Inserts a child object at its position according to its Z order.
+		/// @note Objects with the same Z order are kept in the order they were added, just like when sorting all children.
+		void _insertChild(Object* object);
+		/// @brief Sorts children objects that were appended after the already sorted ones.
+		/// @param[in] sortedCount How many children at the beginning are already sorted.
+		void _mergeChildren(int sortedCount);
+		/// @brief Moves a child object to its new position after its Z order changed.
+		/// @param[in] object The child object, still with its old Z order.
+		/// @param[in] zOrder The new Z order.
+		void _moveChild(Object* object, int zOrder);
+		/// @return The dataset of the root of the tree this object is attached to.
+		/// @note Objects can be attached to trees of other datasets which then draw and update them.
+		Dataset* _getTreeDataset() const;
+		/// @brief Notifies the datasets drawing this object that their recorded draw lists are not valid anymore.
+		void _invalidateDrawList();
+		/// @brief Notifies the dataset that this object has to be drawn again.
+		virtual void _requestRedraw();
+		/// @brief Notifies the dataset that it has to be updated again.
+		void _requestUpdate();
 
 	private:
+		template <typename T>
+		class TypedVisitor
+		{
+		public:
+			bool (*visitor)(T*, void*);
+			void* userData;
+
+			inline TypedVisitor(bool (*visitor)(T*, void*), void* userData) : visitor(visitor), userData(userData) { }
+
+			static inline bool visit(BaseObject* object, void* data)
+			{
+				TypedVisitor<T>* typedVisitor = (TypedVisitor<T>*)data;
+				T* typedObject = dynamic_cast<T*>(object);
+				return (typedObject == NULL || typedVisitor->visitor(typedObject, typedVisitor->userData));
+			}
+
+		};
+
+		/// @brief IDs of the broadcast event types this object is subscribed to.
+		harray<int> _broadcastTypeIds;
+
 		// optimizations
 		harray<Object*> _childrenObjects;
 		harray<Animator*> _childrenAnimators;
+		const harray<PropertyDescription::Accessor*>* _getterTable;
+		const harray<PropertyDescription::Accessor*>* _setterTable;
+
+		void _appendDescendants(harray<BaseObject*>& result) const;
+		void _appendDescendantObjects(harray<Object*>& result) const;
+
+		template <typename T>
+		bool _getPropertyValue(int propertyId, T& value, const PropertyDescription::Type& valueType);
+		template <typename T>
+		bool _setPropertyValue(int propertyId, const T& value, const PropertyDescription::Type& valueType);
 
 		static hmap<hstr, PropertyDescription> _propertyDescriptions;
 		static hmap<hstr, PropertyDescription::Accessor*> _getters;
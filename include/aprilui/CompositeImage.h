@@ -37,6 +37,7 @@ namespace aprilui
 		HL_DEFINE_GETSET(gvec2f, size, SrcSize);
 		HL_DEFINE_GETSET(float, size.x, SrcWidth);
 		HL_DEFINE_GETSET(float, size.y, SrcHeight);
+		/// @note Sub-images are drawn with drawClipped() so their clip rects aren't changed anymore. This is kept for compatibility.
 		HL_DEFINE_ISSET(restoreClipRects, RestoreClipRects);
 		inline const harray<ImageRef>& getImages() { return this->images; }
 
@@ -45,6 +46,7 @@ namespace aprilui
 		
 		void draw(cgrectf rect, const april::Color& color = april::Color::White);
 		void draw(const harray<april::TexturedVertex>& vertices, const april::Color& color = april::Color::White);
+		void drawClipped(cgrectf rect, cgrectf clipRect, const april::Color& color = april::Color::White);
 		
 	protected:
 		gvec2f size;
@@ -66,7 +66,8 @@ namespace aprilui
 		hmap<hstr, PropertyDescription::Accessor*>& _getSetters() const;
 
 		grectf _makeRealSrcRect() const;
-		grectf _makeClippedSrcRect() const;
+		grectf _makeClippedSrcRect(cgrectf clipRect) const;
+		grectf _makeClippedDrawRect(cgrectf rect, cgrectf clipRect) const;
 		
 	private:
 		static hmap<hstr, PropertyDescription> _propertyDescriptions;
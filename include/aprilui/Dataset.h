@@ -13,6 +13,7 @@
 #ifndef APRILUI_DATASET_H
 #define APRILUI_DATASET_H
 
+#include <gtypes/Matrix4.h>
 #include <gtypes/Rectangle.h>
 #include <hltypes/hmap.h>
 #include <hltypes/hlog.h>
@@ -37,6 +38,7 @@ namespace aprilui
 	class Event;
 	class EventArgs;
 	class Image;
+	class MinimalImage;
 	class Object;
 	class Style;
 	class Texture;
@@ -64,7 +66,8 @@ namespace aprilui
 		inline hmap<hstr, BaseImage*>& getImages() { return this->images; }
 		inline hmap<hstr, Texture*>& getTextures() { return this->textures; }
 		inline hmap<hstr, Style*>& getStyles() { return this->styles; }
-		inline hmap<hstr, hstr>& getTexts() { return this->texts; }
+		/// @note Use setTextEntry() and removeTextEntry() to change texts.
+		inline const hmap<hstr, hstr>& getTexts() const { return this->texts; }
 		bool isLoaded();
 		bool isPreLoadingAsync();
 		hmap<hstr, BaseObject*> getAllObjects() const;
@@ -77,6 +80,15 @@ namespace aprilui
 		void unload();
 		void registerObjects(BaseObject* root, bool setRootIfNull = true);
 		void unregisterObjects(BaseObject* root);
+		/// @brief Creates copies of an object subtree and registers them in this dataset.
+		/// @param[in] prototype Root of the subtree that is copied.
+		/// @param[in] count Number of copies.
+		/// @param[in] parent Object the copies are attached to or NULL.
+		/// @param[in] firstIndex Index used in the names of the first copy.
+		/// @return The root objects of the copies.
+		/// @note Every copied object and animator is named after its prototype with the suffix "_<index>". The subtree is flattened only once,
+		/// children are attached in their already sorted order and all copies are registered in one pass.
+		harray<Object*> createInstances(Object* prototype, int count, Object* parent = NULL, int firstIndex = 0);
 		void registerTexture(Texture* texture);
 		void unregisterTexture(Texture* texture);
 		void registerImage(BaseImage* image);
@@ -102,7 +114,24 @@ namespace aprilui
 			return this->animators.dynamicCastValues<hstr, T>();
 		}
 
+		/// @brief Estimates the memory used by this dataset.
+		/// @return Approximate byte counts per category: "objects", "animators", "images", "image_caches", "styles" and "texts" are CPU memory
+		/// while "textures" is GPU memory of currently loaded textures.
+		hmap<hstr, int64_t> getMemoryFootprint();
+		/// @brief Logs the memory footprint per category and the biggest objects, animators, images and textures.
+		/// @param[in] maxEntries Maximum number of the biggest contributors that are listed.
+		void dumpMemoryFootprint(int maxEntries = 20);
 		void updateTextures(float timeDelta);
+		/// @brief Queues the textures used by an object and all of its descendants to be loaded asynchronously ahead of time.
+		/// @param[in] root The object, e.g. the root of the screen that will be shown next.
+		/// @note Textures linked through texture groups are queued as well. Queued textures are started in updateTextures() within the prefetch budget.
+		/// @see aprilui::setTexturePrefetchBudget()
+		void prefetchTextures(Object* root);
+		/// @brief Queues the textures used by the object with the given name and all of its descendants.
+		void prefetchTextures(chstr objectName);
+		void cancelTexturePrefetching();
+		/// @return True if there are still textures waiting to be prefetched.
+		inline bool isPrefetchingTextures() const { return (this->prefetchQueue.size() > 0); }
 		void unloadUnusedResources();
 		void clearChildUnderCursor();
 		
@@ -113,6 +142,39 @@ namespace aprilui
 		virtual void update(float timeDelta);
 		void draw();
 		
+		/// @brief Whether draw() records a flat draw list of all visible objects and replays it instead of traversing the object tree.
+		/// @note The draw list is recorded again automatically when transforms, visibility, clipping or the hierarchy of objects change.
+		HL_DEFINE_IS(retainedDrawing, RetainedDrawing);
+		void setRetainedDrawing(const bool& value);
+		/// @brief Forces the draw list to be recorded again on the next call of draw().
+		void invalidateDrawList();
+
+		/// @brief Whether anything visible changed since the last call of draw().
+		/// @note This is maintained incrementally so it can be checked every frame to skip drawing of a static UI.
+		HL_DEFINE_IS(redrawNeeded, RedrawNeeded);
+		/// @brief Whether the last call of update() had pending work, e.g. running or delayed animators, a blinking caret or textures being loaded.
+		HL_DEFINE_IS(updateNeeded, UpdateNeeded);
+		/// @return True if neither update() nor draw() have to be called until the next input event or change.
+		inline bool isIdle() const { return (!this->redrawNeeded && !this->updateNeeded); }
+		/// @brief Marks the dataset as changed, e.g. after changes that bypass the object setters.
+		void requestRedraw();
+		/// @brief Marks an area in aprilui viewport coordinates as changed.
+		/// @note Without dirty rectangle redrawing this is the same as requestRedraw().
+		void requestRedraw(cgrectf rect);
+		/// @brief Marks the area covered by an object during the last draw() as changed.
+		/// @note Objects with children cause a full redraw since they also affect how their children are drawn. Objects attached to the tree of
+		/// another dataset are marked in that dataset.
+		void requestRedraw(Object* object);
+		/// @brief Marks the dataset as requiring calls of update().
+		void requestUpdate();
+		/// @brief Whether draw() only redraws objects that intersect the areas changed since the last call of draw().
+		/// @note The rest of the back buffer is left intact so this requires a platform that preserves it between frames and the root object has to
+		/// cover changed areas with an opaque background. A full redraw is done instead if the modelview matrix is not the identity matrix.
+		HL_DEFINE_IS(dirtyRectRedrawing, DirtyRectRedrawing);
+		void setDirtyRectRedrawing(const bool& value);
+		/// @return Merged areas that will be redrawn by the next call of draw() if dirty rectangle redrawing is used.
+		HL_DEFINE_GET(harray<grectf>, dirtyRects, DirtyRects);
+		
 		void _destroyTexture(chstr name);
 		void _destroyImage(chstr name);
 		void _destroyStyle(chstr name);
@@ -126,6 +188,9 @@ namespace aprilui
 		bool onMouseDown(april::Key keyCode);
 		bool onMouseUp(april::Key keyCode);
 		bool onMouseCancel(april::Key keyCode);
+		/// @note With pointer routing only the objects under the cursor, the focused object and objects that are tracking the pointer receive
+		/// the move, together with their ancestors.
+		/// @see setPointerRouting()
 		bool onMouseMove();
 		bool onMouseScroll(float x, float y);
 		bool onKeyDown(april::Key keyCode);
@@ -138,6 +203,16 @@ namespace aprilui
 		bool onTouch(const harray<gvec2f>& touches);
 		bool onButtonDown(april::Button buttonCode);
 		bool onButtonUp(april::Button buttonCode);
+		/// @brief Captures a touch for an object.
+		/// @param[in] index Index of the touch.
+		/// @param[in] object The object that receives all further moves, ups and cancels of the touch directly.
+		/// @note The capture is released automatically when the touch ends or is canceled.
+		void captureTouch(int index, Object* object);
+		/// @brief Releases a captured touch so it is passed through the whole tree again.
+		/// @param[in] index Index of the touch.
+		void releaseTouch(int index);
+		/// @return The object that captured a touch or NULL if the touch is not captured.
+		Object* getTouchCapture(int index) const;
 		
 		virtual Object* getObject(chstr name);
 		virtual Animator* getAnimator(chstr name);
@@ -151,9 +226,36 @@ namespace aprilui
 		bool hasStyle(chstr name) const;
 		bool hasObject(chstr name) const;
 		bool hasAnimator(chstr name) const;
+		/// @brief Gets an object by the interned ID of its name.
+		/// @param[in] nameId ID of the name or of a "dataset.name" reference.
+		/// @return The object.
+		/// @note Resolved handles are cached by ID so repeated lookups avoid hashing and splitting the name.
+		/// @see aprilui::internName()
+		Object* getObjectByNameId(int nameId);
+		/// @return The object or NULL if it doesn't exist.
+		/// @see getObjectByNameId()
+		Object* tryGetObjectByNameId(int nameId);
+		/// @see getObjectByNameId()
+		BaseImage* getImageByNameId(int nameId);
+		/// @see getObjectByNameId()
+		Style* getStyleByNameId(int nameId);
+		/// @see getObjectByNameId()
+		hstr getTextEntryByNameId(int nameId);
+		/// @see getObjectByNameId()
+		bool hasTextEntryByNameId(int nameId);
 
 		virtual hstr getTextEntry(chstr textKey);
 		virtual bool hasTextEntry(chstr textKey);
+		/// @brief Sets a text entry in this dataset.
+		/// @param[in] textKey The text key.
+		/// @param[in] text The new text.
+		void setTextEntry(chstr textKey, chstr text);
+		/// @brief Removes a text entry from this dataset.
+		/// @param[in] textKey The text key.
+		/// @return True if the text entry existed.
+		bool removeTextEntry(chstr textKey);
+		/// @note Composite text keys are compiled into templates that are cached per key structure until texts in any dataset change.
+		/// Literal arguments are inserted into the cached template on every call.
 		virtual hstr getText(chstr compositeTextKey);
 		harray<hstr> getTexts(const harray<hstr>& keys);
 		
@@ -219,8 +321,19 @@ namespace aprilui
 			out = this->tryGetAnimator<T>(name);
 		}
 
-		void notifyEvent(chstr type, EventArgs* args);
+		/// @brief Whether notifyEvent() only reaches objects and animators that are subscribed to the event type instead of visiting all of them.
+		/// @note Event types that nothing is subscribed to are still broadcast to all objects and animators. All classes that handle a broadcast
+		/// event type in notifyEvent() have to subscribe to it before this can be enabled.
+		/// @see BaseObject::subscribeBroadcast()
+		HL_DEFINE_ISSET(subscribedBroadcasting, SubscribedBroadcasting);
+		/// @brief Whether onMouseMove() only reaches the objects under the cursor, the focused object and objects that are tracking the pointer
+		/// instead of visiting the whole tree.
+		/// @note All classes that react to mouse moves outside of their bounds have to override Object::_isTrackingPointer() before this can be enabled.
+		HL_DEFINE_IS(pointerRouting, PointerRouting);
+		void setPointerRouting(bool value);
 		void reloadTexts();
+		/// @brief Clears the cached templates of composite text keys in all datasets.
+		void clearCompositeTextsCache();
 		void reloadTextures();
 		void focus(Object* object);
 		void removeFocus();
@@ -257,6 +370,20 @@ namespace aprilui
 		};
 		friend class LoadThread;
 
+		class TextsLoadThread : public hthread
+		{
+		public:
+			Dataset* dataset;
+			harray<hstr> filenames;
+			harray<hmap<hstr, hstr> > texts;
+			/// @brief Messages of the exceptions that were raised while loading files, by filename.
+			hmap<hstr, hstr> errorMessages;
+
+			TextsLoadThread();
+
+		};
+		friend class TextsLoadThread;
+
 		hstr name;
 		hstr filename;
 		hstr filePath;
@@ -264,15 +391,38 @@ namespace aprilui
 		bool loaded;
 		Object* focusedObject;
 		Object* root;
+		/// @brief Objects that were hovered or pushed after the last mouse event so they still receive mouse moves after the cursor left them.
+		harray<Object*> pointerObjects;
 		hmap<hstr, Object*> objects;
+		/// @brief Objects that were already looked up by the interned IDs of their names.
+		hmap<int, Object*> objectsByNameId;
 		hmap<hstr, Animator*> animators;
 		hmap<hstr, Texture*> textures;
 		hmap<hstr, BaseImage*> images;
 		hmap<hstr, Style*> styles;
+		/// @brief Images and styles that were already looked up by the interned IDs of their names.
+		hmap<int, BaseImage*> imagesByNameId;
+		hmap<int, Style*> stylesByNameId;
 		hmap<hstr, hstr> texts;
+		/// @brief Texts that were already looked up by the interned IDs of their keys.
+		hmap<int, hstr> textsByNameId;
+		/// @brief Objects that captured touches by touch index.
+		hmap<int, Object*> touchCaptures;
 		harray<QueuedCallback> callbackQueue;
 		hmap<hstr, void (*)()> callbacks;
 		hmap<hstr, hlxml::Document*> includeDocuments;
+		bool retainedDrawing;
+		bool redrawNeeded;
+		bool updateNeeded;
+		bool dirtyRectRedrawing;
+		harray<grectf> dirtyRects;
+		bool subscribedBroadcasting;
+		bool pointerRouting;
+		harray<harray<hstr> > textureGroups;
+		harray<Texture*> prefetchQueue;
+		harray<Texture*> _atlasTextures;
+		hmap<MinimalImage*, Texture*> _atlasImageTextures;
+		hmap<MinimalImage*, grectf> _atlasImageSrcRects;
 
 		hlxml::Document* _openDocument(chstr filename);
 		void _closeDocuments();
@@ -291,15 +441,31 @@ namespace aprilui
 		BaseObject* _recursiveObjectIncludeParse(hlxml::Node* node, Object* parent, Style* style, chstr namePrefix, chstr nameSuffix, cgvec2f offset, bool setRootIfNull = true);
 
 		virtual void _load();
+		/// @brief Packs small textures of this dataset into shared atlas pages and redirects the images to them.
+		/// @see aprilui::setTextureAtlasPageSize()
+		void _buildTextureAtlases();
+		/// @return Index of the next atlas page.
+		int _buildTextureAtlas(harray<Texture*> textures, int pageIndex);
+		/// @brief Redirects the images back to their original textures and destroys all atlas pages.
+		void _destroyTextureAtlases();
+		/// @brief Redirects an image back to its original texture and forgets about it before it is destroyed or unregistered.
+		void _removeAtlasImage(BaseImage* image);
+		/// @brief Redirects the images that were packed from or into a texture back to their original textures before it is destroyed or unregistered.
+		void _removeAtlasTexture(Texture* texture);
 		void _readFile(chstr filename);
 		virtual void _loadTexts(chstr path);
+		void _loadTextFile(chstr filename, hmap<hstr, hstr>& textsMap);
 		void _loadTextResource(hstream& data, hmap<hstr, hstr>& textsMap);
+		/// @note Parses the raw data in a single pass without splitting it into lines first.
+		void _loadTextResource(const char* data, int size, hmap<hstr, hstr>& textsMap);
 		virtual void _unload();
+		void _updateTexturePrefetching();
 		hstr _makeFilePath(chstr filename, chstr name = "", bool useNameBasePath = false);
 		hstr _makeLocalizedTextureName(chstr filename);
 		hstr _findLocalizedTextureFilename(chstr filename, chstr localization);
 		hstr _makeTextsPath(chstr textsPath);
 		bool _findTextEntry(chstr textKey, hstr* text);
+		bool _findTextEntryByNameId(int nameId, hstr* text);
 
 		hstr _parseCompositeTextKey(chstr key);
 		bool _processCompositeTextKeyArgs(std::ustring uArgString, harray<std::ustring>& uArgs);
@@ -313,11 +479,121 @@ namespace aprilui
 
 		static void _asyncLoad(hthread* thread);
 		static void _asyncHlXmlLoad(hthread* thread);
+		static void _asyncTextsLoad(hthread* thread);
+		/// @brief Broadcasts an event to all objects and animators.
+		/// @param[in] typeId ID of the event type.
+		/// @param[in] args The event arguments.
+		/// @note With subscribed broadcasting only objects and animators that are subscribed to the event type are notified.
+		/// @see setSubscribedBroadcasting()
+		void _notifyEvent(int typeId, EventArgs* args);
 
 	private:
+		friend class BaseObject;
+		friend class Object;
+		friend class Texture;
+
+		class InstanceNode
+		{
+		public:
+			BaseObject* prototype;
+			int parentIndex;
+
+			InstanceNode(BaseObject* prototype = NULL, int parentIndex = -1);
+
+		};
+
+		class TextureIdleDeadline
+		{
+		public:
+			double time;
+			Texture* texture;
+
+			TextureIdleDeadline(double time = 0.0, Texture* texture = NULL);
+
+			/// @note Inverted so the standard heap algorithms keep the earliest deadline on top.
+			inline bool operator<(const TextureIdleDeadline& other) const { return (this->time > other.time); }
+
+		};
+
+		class DrawListEntry
+		{
+		public:
+			Object* object;
+			gmat4 modelviewMatrix;
+			gmat4 projectionMatrix;
+			grecti viewport;
+			bool clipChanged;
+
+			DrawListEntry();
+
+		};
+
 		bool _asyncPreLoading;
 		LoadThread* _asyncPreLoadThread;
 		Dataset* _internalLoadDataset;
+		/// @brief Compiled templates of composite text keys where literal arguments are replaced with placeholders.
+		hmap<hstr, hstr> _compositeTexts;
+		int _compositeTextsRevision;
+		int _textsByNameIdRevision;
+		class BroadcastSubscribers
+		{
+		public:
+			harray<BaseObject*> objects;
+			/// @brief Indices of the objects so they can be removed without searching.
+			hmap<BaseObject*, int> indices;
+
+		};
+
+		/// @brief Registered objects and animators by the IDs of the event types they are subscribed to.
+		hmap<int, BroadcastSubscribers> _broadcastSubscribers;
+		harray<DrawListEntry> _drawList;
+		bool _drawListValid;
+		Object* _drawListRoot;
+		gmat4 _drawListModelviewMatrix;
+		gmat4 _drawListProjectionMatrix;
+		grecti _drawListViewport;
+		bool _drawListDebug;
+
+		bool _fullRedrawNeeded;
+		/// @brief Accumulated time of updateTextures() used for texture idle times.
+		double _textureTime;
+		/// @brief Texture idle unload time that the idle deadlines were scheduled with.
+		float _textureIdleUnloadTime;
+		/// @brief Binary heap of idle deadlines of loaded managed textures.
+		harray<TextureIdleDeadline> _textureIdleDeadlines;
+		/// @brief Textures that are still loading asynchronously.
+		harray<Texture*> _loadingTextures;
+
+		void _drawRetained();
+		void _drawDirtyRects();
+		void _recordDrawListEntry(Object* object);
+		void _scheduleTextureIdleDeadline(Texture* texture);
+
+		static void _captureInstanceNodes(Object* object, int parentIndex, harray<InstanceNode>& nodes);
+		void _unscheduleTexture(Texture* texture);
+		void _updateTextureIdleDeadlines();
+		void _rescheduleTextureIdleDeadlines();
+		void _registerObject(BaseObject* object);
+		void _unregisterObject(BaseObject* object);
+		void _destroyObject(BaseObject* object);
+
+		static bool _visitRegisterObject(BaseObject* object, void* userData);
+		static bool _visitNotifyRegistered(BaseObject* object, void* userData);
+		static bool _visitUnregisterObject(BaseObject* object, void* userData);
+		static bool _visitDestroyObject(BaseObject* object, void* userData);
+		static bool _visitUsedImages(Object* object, void* userData);
+		void _subscribeBroadcasts(BaseObject* object);
+		/// @brief Releases all touches captured by an object or its descendants.
+		void _releaseTouches(Object* object);
+		/// @brief Adds an object and its ancestors to the objects that receive a mouse move, unless they are not attached to the root.
+		void _addPointerChain(harray<Object*>& objects, Object* object);
+		void _unsubscribeBroadcasts(BaseObject* object);
+		void _addBroadcastSubscriber(int typeId, BaseObject* object);
+		void _removeBroadcastSubscriber(int typeId, BaseObject* object);
+
+		static Dataset* _drawListRecorder;
+		static bool _drawBoundsRecording;
+		static const grectf* _drawDirtyRect;
 
 	};
 
@@ -26,6 +26,56 @@ namespace aprilui
 	{
 		APRILUI_CLONEABLE_ABSTRACT(Event);
 	public:
+		/// @brief IDs of system event types. They are pre-assigned so they can be used in switch statements.
+		enum TypeId
+		{
+			InvalidTypeId = 0,
+			DatasetLoadedId,
+			DatasetUnloadedId,
+			RegisteredInDatasetId,
+			UnregisteredFromDatasetId,
+			TextureLoadedId,
+			TextureUnloadedId,
+			AttachedToObjectId,
+			DetachedFromObjectId,
+			MouseDownId,
+			MouseUpId,
+			MouseMoveId,
+			MouseScrollId,
+			MouseCancelId,
+			ClickId,
+			KeyDownId,
+			KeyUpId,
+			TouchDownId,
+			TouchUpId,
+			TouchMoveId,
+			TouchCancelId,
+			TapId,
+			ButtonDownId,
+			ButtonUpId,
+			ButtonTriggerId,
+			EnabledChangedId,
+			AwakeChangedId,
+			PositionChangedId,
+			SizeChangedId,
+			FocusGainedId,
+			FocusLostId,
+			HoverStartedId,
+			HoverFinishedId,
+			TextChangedId,
+			TextKeyChangedId,
+			LocalizationChangedId,
+			SubmitEditTextId,
+			ScrollSkinChangedId,
+			SetProgressValueId,
+			SelectedChangedId,
+			NodeExpandedId,
+			NodeCollapsedId,
+			AnimationDelayExpiredId,
+			AnimationExpiredId,
+			FirstCustomTypeId // custom event types get IDs starting with this one when they are first used
+		};
+
 		static hstr DatasetLoaded;
 		static hstr DatasetUnloaded;
 		static hstr RegisteredInDataset;
@@ -75,6 +125,17 @@ namespace aprilui
 		virtual void execute(EventArgs* args) = 0;
 
 		static bool isSystemEvent(chstr type, bool caseSensitive = true);
+		/// @brief Gets the ID of an event type.
+		/// @param[in] type The event type.
+		/// @return The ID of the event type. Custom event types are assigned a new ID when they are used for the first time.
+		/// @note System event types are resolved without locking.
+		static int getTypeId(chstr type);
+		/// @brief Gets the ID of an event type without assigning a new one to unknown custom event types.
+		/// @param[in] type The event type.
+		/// @return The ID of the event type or InvalidTypeId if the event type was never used.
+		static int findTypeId(chstr type);
+		/// @return The event type with the given ID or an empty string if the ID is not valid.
+		static hstr getTypeName(int typeId);
 
 	};
 
@@ -31,6 +31,9 @@ namespace aprilui
 	{
 	public:
 		hstr eventType;
+		/// @brief ID of the event type that can be used in switch statements.
+		/// @see Event::getTypeId()
+		int eventTypeId;
 		EventReceiver* receiver;
 		BaseObject* baseObject;
 		Object* object;
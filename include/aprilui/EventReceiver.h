@@ -36,14 +36,28 @@ namespace aprilui
 		~EventReceiver();
 
 		virtual hstr getName() const = 0;
-		inline hmap<hstr, Event*>& getEvents() { return this->events; }
+		/// @return The registered handlers by event type.
+		/// @note Use registerEvent() and unregisterEvent() to change the registered handlers.
+		hmap<hstr, Event*> getEvents() const;
 
 		bool registerEvent(chstr type, void(*callback)(EventArgs*));
 		bool registerEvent(chstr type, Event* event);
 		bool unregisterEvent(chstr type);
 		bool isEventRegistered(chstr type) const;
+		/// @brief Gets the handler of an event type.
+		/// @param[in] typeId ID of the event type.
+		/// @return The handler or NULL if none is registered.
+		/// @see Event::getTypeId()
+		Event* getEvent(int typeId) const;
 
-		virtual void notifyEvent(chstr type, EventArgs* args);
+		/// @brief Notifies the receiver about an event.
+		/// @param[in] type The event type.
+		/// @param[in] args The event arguments. Can be NULL.
+		/// @note Internal notifications pass the type ID directly, override _notifyEvent() to handle them.
+		void notifyEvent(chstr type, EventArgs* args);
+		/// @param[in] typeId ID of the event type.
+		/// @param[in] args The event arguments. Can be NULL.
+		void notifyEvent(int typeId, EventArgs* args);
 
 		virtual bool triggerEvent(chstr type, april::Key keyCode);
 		virtual bool triggerEvent(chstr type, april::Key keyCode, chstr string);
@@ -51,10 +65,25 @@ namespace aprilui
 		virtual bool triggerEvent(chstr type, april::Button buttonCode, chstr string = "", void* userData = NULL);
 		virtual bool triggerEvent(chstr type, chstr string, void* userData = NULL);
 		virtual bool triggerEvent(chstr type, void* userData = NULL);
+		/// @note These take the ID of the event type so the type doesn't have to be hashed to find the handler.
+		virtual bool triggerEvent(int typeId, april::Key keyCode);
+		virtual bool triggerEvent(int typeId, april::Key keyCode, chstr string);
+		virtual bool triggerEvent(int typeId, april::Key keyCode, cgvec2f position, chstr string = "", void* userData = NULL);
+		virtual bool triggerEvent(int typeId, april::Button buttonCode, chstr string = "", void* userData = NULL);
+		virtual bool triggerEvent(int typeId, chstr string, void* userData = NULL);
+		virtual bool triggerEvent(int typeId, void* userData = NULL);
 
 	protected:
 		Dataset* dataset;
-		hmap<hstr, Event*> events;
+		/// @brief Event type IDs of the registered handlers.
+		/// @note Receivers only have a few handlers so a flat table is faster to search than a map.
+		harray<int> eventTypeIds;
+		/// @brief Registered handlers in the same order as eventTypeIds.
+		harray<Event*> eventHandlers;
+
+		Event* _findEvent(chstr type) const;
+
+		virtual void _notifyEvent(int typeId, EventArgs* args);
 
 	};
 
@@ -77,6 +77,7 @@ namespace aprilui
 
 		void draw(cgrectf rect, const april::Color& color = april::Color::White);
 		void draw(const harray<april::TexturedVertex>& vertices, const april::Color& color = april::Color::White);
+		void drawClipped(cgrectf rect, cgrectf clipRect, const april::Color& color = april::Color::White);
 
 	protected:
 		april::Color colorTopLeft;
@@ -87,12 +88,12 @@ namespace aprilui
 		april::BlendMode blendMode;
 		april::ColorMode colorMode;
 		float colorModeFactor;
-		april::ColoredTexturedVertex coloredVertices[APRILUI_IMAGE_MAX_VERTICES];
 
 		hmap<hstr, PropertyDescription::Accessor*>& _getGetters() const;
 		hmap<hstr, PropertyDescription::Accessor*>& _getSetters() const;
 
-		void _drawWithCorners(cgrectf rect, const april::Color& color);
+		/// @brief Builds the vertices on the stack and renders them, used by both draw() and drawClipped().
+		void _drawClipped(cgrectf rect, cgrectf clipRect, const april::Color& color);
 
 	private:
 		static hmap<hstr, PropertyDescription> _propertyDescriptions;
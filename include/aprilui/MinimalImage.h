@@ -26,6 +26,7 @@
 #include "PropertyDescription.h"
 
 #define APRILUI_IMAGE_MAX_VERTICES 6
+#define APRILUI_IMAGE_MAX_CLIPPED_TEXTURE_COORDINATES 8
 
 namespace aprilui
 {
@@ -43,6 +44,7 @@ namespace aprilui
 		hmap<hstr, PropertyDescription>& getPropertyDescriptions() const;
 
 		HL_DEFINE_GET(Texture*, texture, Texture);
+		void setTexture(Texture* const& value);
 		HL_DEFINE_GET(grectf, srcRect, SrcRect);
 		void setSrcRect(cgrectf value);
 		void setSrcRect(const float& x, const float& y, const float& width, const float& height);
@@ -62,25 +64,51 @@ namespace aprilui
 		void setSrcSize(const float& w, const float& h);
 		inline const april::TexturedVertex* getVertices() const { return this->vertices; } // use with care!
 
+		int64_t getByteSize() const;
+		int64_t getCacheByteSize() const;
+
 		hstr getProperty(chstr name);
 
 		void draw(cgrectf rect, const april::Color& color = april::Color::White);
 		void draw(const harray<april::TexturedVertex>& vertices, const april::Color& color = april::Color::White);
+		void drawClipped(cgrectf rect, cgrectf clipRect, const april::Color& color = april::Color::White);
 
 		bool tryLoadTextureCoordinates();
 
 	protected:
+		typedef std::pair<grectf, grectf> ClippedTextureCoordinates;
+
 		Texture* texture;
 		grectf srcRect;
 		april::TexturedVertex vertices[APRILUI_IMAGE_MAX_VERTICES];
 		bool _textureCoordinatesLoaded;
+		/// @brief Texture coordinates for recently used clip rects in drawClipped().
+		harray<ClippedTextureCoordinates> _clippedTextureCoordinates;
+		gvec2i _clippedTextureCoordinatesTextureSize;
 
 		hmap<hstr, PropertyDescription::Accessor*>& _getGetters() const;
 		hmap<hstr, PropertyDescription::Accessor*>& _getSetters() const;
 
-		virtual grectf _makeClippedSrcRect() const;
+		virtual grectf _makeClippedSrcRect(cgrectf clipRect) const;
+		virtual grectf _makeClippedDrawRect(cgrectf rect, cgrectf clipRect) const;
+		bool _findClippedTextureCoordinates(cgrectf clipRect, grectf& textureRect);
 		
-		void _setDeviceTexture();
+		/// @return False if the texture upload was deferred by the upload budget and there is no placeholder, so nothing should be drawn.
+		/// @see aprilui::setTextureUploadBudget()
+		bool _setDeviceTexture();
+
+		template <typename V>
+		static inline void _makeVertices(V* vertices, cgrectf drawRect, cgrectf textureRect)
+		{
+			vertices[0].x = vertices[2].x = vertices[4].x = drawRect.left();
+			vertices[0].y = vertices[1].y = vertices[3].y = drawRect.top();
+			vertices[1].x = vertices[3].x = vertices[5].x = drawRect.right();
+			vertices[2].y = vertices[4].y = vertices[5].y = drawRect.bottom();
+			vertices[0].u = vertices[2].u = vertices[4].u = textureRect.left();
+			vertices[0].v = vertices[1].v = vertices[3].v = textureRect.top();
+			vertices[1].u = vertices[3].u = vertices[5].u = textureRect.right();
+			vertices[2].v = vertices[4].v = vertices[5].v = textureRect.bottom();
+		}
 		
 	private:
 		static hmap<hstr, PropertyDescription> _propertyDescriptions;
@@ -88,28 +88,40 @@ namespace aprilui
 		HL_DEFINE_GET(float, unlimitedSize.x, UnlimitedWidth);
 		HL_DEFINE_GET(float, unlimitedSize.y, UnlimitedHeight);
 
-		HL_DEFINE_GETSET(gvec2f, pivot, Pivot);
-		inline void setPivot(float x, float y) { this->pivot.set(x, y); }
-		HL_DEFINE_GETSET(float, pivot.x, PivotX);
-		HL_DEFINE_GETSET(float, pivot.y, PivotY);
-
-		HL_DEFINE_GETSET(april::Color, color, Color);
+		HL_DEFINE_GET(gvec2f, pivot, Pivot);
+		void setPivot(cgvec2f value);
+		void setPivot(float x, float y);
+		HL_DEFINE_GET(float, pivot.x, PivotX);
+		void setPivotX(const float& value);
+		HL_DEFINE_GET(float, pivot.y, PivotY);
+		void setPivotY(const float& value);
+
+		HL_DEFINE_GET(april::Color, color, Color);
+		void setColor(const april::Color& value);
 		void setSymbolicColor(chstr value);
-		HL_DEFINE_GETSET(unsigned char, color.r, Red);
-		HL_DEFINE_GETSET(unsigned char, color.g, Green);
-		HL_DEFINE_GETSET(unsigned char, color.b, Blue);
-		HL_DEFINE_GETSET(unsigned char, color.a, Alpha);
+		HL_DEFINE_GET(unsigned char, color.r, Red);
+		void setRed(const unsigned char& value);
+		HL_DEFINE_GET(unsigned char, color.g, Green);
+		void setGreen(const unsigned char& value);
+		HL_DEFINE_GET(unsigned char, color.b, Blue);
+		void setBlue(const unsigned char& value);
+		HL_DEFINE_GET(unsigned char, color.a, Alpha);
+		void setAlpha(const unsigned char& value);
 
 		inline bool isVisible() const { return (this->visible && this->color.a > 0); }
-		HL_DEFINE_SET(bool, visible, Visible);
+		void setVisible(const bool& value);
 		inline bool getVisibilityFlag() const { return this->visible; }
 
-		HL_DEFINE_GETSET(gvec2f, scaleFactor, Scale);
-		inline void setScale(float x, float y) { this->scaleFactor.set(x, y); }
-		HL_DEFINE_GETSET(float, scaleFactor.x, ScaleX);
-		HL_DEFINE_GETSET(float, scaleFactor.y, ScaleY);
+		HL_DEFINE_GET(gvec2f, scaleFactor, Scale);
+		void setScale(cgvec2f value);
+		void setScale(float x, float y);
+		HL_DEFINE_GET(float, scaleFactor.x, ScaleX);
+		void setScaleX(const float& value);
+		HL_DEFINE_GET(float, scaleFactor.y, ScaleY);
+		void setScaleY(const float& value);
 
-		HL_DEFINE_GETSET(float, angle, Angle);
+		HL_DEFINE_GET(float, angle, Angle);
+		void setAngle(const float& value);
 		HL_DEFINE_ISSET(anchorLeft, AnchorLeft);
 		HL_DEFINE_ISSET(anchorRight, AnchorRight);
 		HL_DEFINE_ISSET(anchorTop, AnchorTop);
@@ -117,11 +129,20 @@ namespace aprilui
 		HL_DEFINE_IS(retainAnchorAspect, RetainAnchorAspect);
 		void setRetainAnchorAspect(const bool& value);
 		HL_DEFINE_GETSET(HitTest, hitTest, HitTest);
-		HL_DEFINE_ISSET(inheritAlpha, InheritAlpha);
-		HL_DEFINE_ISSET(useDisabledAlpha, UseDisabledAlpha);
-		HL_DEFINE_GETSET(float, disabledAlphaFactor, DisabledAlphaFactor);
-		HL_DEFINE_ISSET(clip, Clip);
-		HL_DEFINE_ISSET(useClipRound, UseClipRound);
+		HL_DEFINE_IS(inheritAlpha, InheritAlpha);
+		void setInheritAlpha(const bool& value);
+		HL_DEFINE_IS(useDisabledAlpha, UseDisabledAlpha);
+		void setUseDisabledAlpha(const bool& value);
+		/// @brief Whether touches accepted by this object are captured.
+		/// @note Moves, ups and cancels of a captured touch are delivered only to this object until the touch ends or is released.
+		/// @see Dataset::captureTouch()
+		HL_DEFINE_ISSET(captureTouches, CaptureTouches);
+		HL_DEFINE_GET(float, disabledAlphaFactor, DisabledAlphaFactor);
+		void setDisabledAlphaFactor(const float& value);
+		HL_DEFINE_IS(clip, Clip);
+		void setClip(const bool& value);
+		HL_DEFINE_IS(useClipRound, UseClipRound);
+		void setUseClipRound(const bool& value);
 		virtual inline int getFocusIndex() const { return this->focusIndex; }
 		HL_DEFINE_SET(int, focusIndex, FocusIndex);
 		CustomPointInsideCallback getCustomPointInsideCallback() { return this->customPointInsideCallback; }
@@ -134,6 +155,7 @@ namespace aprilui
 		virtual void setFocused(const bool& focused);
 		virtual bool isCursorInside() const;
 		harray<BaseImage*> getUsedImages() const;
+		int64_t getByteSize() const;
 		Object* getChildUnderCursor();
 
 		void update(float timeDelta);
@@ -166,6 +188,10 @@ namespace aprilui
 		void clearDescendantChildrenUnderCursor();
 
 		void addChild(BaseObject* object);
+		/// @brief Adds multiple children at once, sorting them only once.
+		/// @param[in] objects The children to add.
+		/// @note All children are attached before any of them is notified.
+		void addChildren(const harray<BaseObject*>& objects);
 		void removeChild(BaseObject* object);
 		void registerChild(BaseObject* object);
 		void unregisterChild(BaseObject* object);
@@ -306,6 +332,7 @@ namespace aprilui
 		bool useClipRound;
 		bool inheritAlpha;
 		bool useDisabledAlpha;
+		bool captureTouches;
 		float disabledAlphaFactor;
 		int focusIndex;
 		CustomPointInsideCallback customPointInsideCallback;
@@ -313,6 +340,9 @@ namespace aprilui
 		april::Color debugColor;
 		
 		void _cloneChildren(const harray<Object*>& objects, const harray<Animator*>& animators);
+		/// @brief Attaches a child like addChild(), but without sorting the children.
+		/// @note Children have to be appended in their z-order, e.g. when copying the already sorted children of another object.
+		void _appendChild(BaseObject* obj);
 
 		hmap<hstr, PropertyDescription::Accessor*>& _getGetters() const;
 		hmap<hstr, PropertyDescription::Accessor*>& _getSetters() const;
@@ -321,6 +351,7 @@ namespace aprilui
 		virtual harray<BaseImage*> _getUsedImages() const;
 
 		void _update(float timeDelta);
+		void _requestRedraw();
 		virtual void _draw();
 		virtual void _drawDebug();
 
@@ -333,6 +364,9 @@ namespace aprilui
 		float _makeCorrectedWidth(const float& width);
 		float _makeCorrectedHeight(const float& height);
 		grectf _makeDrawRect() const;
+		/// @brief Makes the area that drawing this object can cover, including content that reaches outside of the draw rect.
+		/// @note Used for the cached bounds when redrawing only dirty rectangles.
+		virtual grectf _makeDrawBounds();
 		april::Color _makeDrawColor() const;
 		virtual april::Color _makeDrawColor(const april::Color& color) const;
 
@@ -341,6 +375,9 @@ namespace aprilui
 		virtual bool _mouseUp(april::Key keyCode);
 		virtual void _mouseCancel(april::Key keyCode);
 		virtual bool _mouseMove();
+		/// @brief Whether this object has to receive mouse moves even while the cursor is not over it, e.g. to end hovering or a drag.
+		/// @see Dataset::onMouseMove()
+		virtual bool _isTrackingPointer() const;
 		virtual bool _mouseScroll(float x, float y);
 		virtual bool _keyDown(april::Key keyCode);
 		virtual bool _keyUp(april::Key keyCode);
@@ -358,6 +395,8 @@ namespace aprilui
 		bool _initialPivotY;
 		Object* _childUnderCursor;
 		bool _checkedChildUnderCursor;
+		/// @brief Whether this object is currently passing input to its children.
+		bool _dispatchingInput;
 
 		// optimizations
 		harray<Animator*> _dynamicAnimators;
@@ -375,10 +414,22 @@ namespace aprilui
 		gvec2f _drawPosition;
 		grectf _drawRect;
 		april::Color _drawFrameColor;
+		grectf _drawBoundingRect;
 
 		static hmap<hstr, PropertyDescription> _propertyDescriptions;
 		static hmap<hstr, PropertyDescription::Accessor*> _getters;
 		static hmap<hstr, PropertyDescription::Accessor*> _setters;
+		/// @brief Children of all objects that are currently passing input to their children.
+		/// @note This is shared so input dispatching doesn't have to allocate a copy of the children on every level.
+		static harray<Object*> _inputChildren;
+
+		/// @brief Checks whether this object can receive input.
+		/// @note This is faster than isDerivedEnabled() while the parent is passing input, because the parent was already checked.
+		bool _isInputEnabled() const;
+		/// @brief Copies the children to the shared input dispatch array.
+		/// @return Index of the first copied child.
+		int _pushInputChildren();
+		void _popInputChildren(int first);
 
 	};
 	
@@ -62,6 +62,12 @@ namespace aprilui
 		virtual bool triggerEvent(chstr type, april::Button buttonCode, chstr string = "", void* userData = NULL) = 0;
 		virtual bool triggerEvent(chstr type, chstr string, void* userData = NULL) = 0;
 		virtual bool triggerEvent(chstr type, void* userData = NULL) = 0;
+		virtual bool triggerEvent(int typeId, april::Key keyCode) = 0;
+		virtual bool triggerEvent(int typeId, april::Key keyCode, chstr string) = 0;
+		virtual bool triggerEvent(int typeId, april::Key keyCode, cgvec2f position, chstr string = "", void* userData = NULL) = 0;
+		virtual bool triggerEvent(int typeId, april::Button buttonCode, chstr string = "", void* userData = NULL) = 0;
+		virtual bool triggerEvent(int typeId, chstr string, void* userData = NULL) = 0;
+		virtual bool triggerEvent(int typeId, void* userData = NULL) = 0;
 
 		static harray<april::Key> allowedKeys;
 		static harray<april::Button> allowedButtons;
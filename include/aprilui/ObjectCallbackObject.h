@@ -30,8 +30,8 @@ namespace aprilui
 		static Object* createInstance(chstr name);
 
 		inline void (*getDrawCallback())(CallbackObject*) { return this->drawCallback; }
-		inline void setDrawCallback(void (*value)(CallbackObject*)) { this->drawCallback = value; }
-		inline void setUpdateCallback(void (*value)(float)) { this->updateCallback = value; }
+		void setDrawCallback(void (*value)(CallbackObject*));
+		void setUpdateCallback(void (*value)(float));
 		
 	protected:
 		void (*drawCallback)(CallbackObject*);
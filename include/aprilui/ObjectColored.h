@@ -35,25 +35,38 @@ namespace aprilui
 		HL_DEFINE_GET(april::Color, colorTopRight, ColorTopRight);
 		void setColorTopRight(const april::Color& value);
 		void setSymbolicColorTopRight(chstr value);
-		HL_DEFINE_GETSET(unsigned char, colorTopRight.r, RedTopRight);
-		HL_DEFINE_GETSET(unsigned char, colorTopRight.g, GreenTopRight);
-		HL_DEFINE_GETSET(unsigned char, colorTopRight.b, BlueTopRight);
-		HL_DEFINE_GETSET(unsigned char, colorTopRight.a, AlphaTopRight);
+		HL_DEFINE_GET(unsigned char, colorTopRight.r, RedTopRight);
+		void setRedTopRight(const unsigned char& value);
+		HL_DEFINE_GET(unsigned char, colorTopRight.g, GreenTopRight);
+		void setGreenTopRight(const unsigned char& value);
+		HL_DEFINE_GET(unsigned char, colorTopRight.b, BlueTopRight);
+		void setBlueTopRight(const unsigned char& value);
+		HL_DEFINE_GET(unsigned char, colorTopRight.a, AlphaTopRight);
+		void setAlphaTopRight(const unsigned char& value);
 		HL_DEFINE_GET(april::Color, colorBottomLeft, ColorBottomLeft);
 		void setColorBottomLeft(const april::Color& value);
 		void setSymbolicColorBottomLeft(chstr value);
-		HL_DEFINE_GETSET(unsigned char, colorBottomLeft.r, RedBottomLeft);
-		HL_DEFINE_GETSET(unsigned char, colorBottomLeft.g, GreenBottomLeft);
-		HL_DEFINE_GETSET(unsigned char, colorBottomLeft.b, BlueBottomLeft);
-		HL_DEFINE_GETSET(unsigned char, colorBottomLeft.a, AlphaBottomLeft);
+		HL_DEFINE_GET(unsigned char, colorBottomLeft.r, RedBottomLeft);
+		void setRedBottomLeft(const unsigned char& value);
+		HL_DEFINE_GET(unsigned char, colorBottomLeft.g, GreenBottomLeft);
+		void setGreenBottomLeft(const unsigned char& value);
+		HL_DEFINE_GET(unsigned char, colorBottomLeft.b, BlueBottomLeft);
+		void setBlueBottomLeft(const unsigned char& value);
+		HL_DEFINE_GET(unsigned char, colorBottomLeft.a, AlphaBottomLeft);
+		void setAlphaBottomLeft(const unsigned char& value);
 		HL_DEFINE_GET(april::Color, colorBottomRight, ColorBottomRight);
 		void setColorBottomRight(const april::Color& value);
 		void setSymbolicColorBottomRight(chstr value);
-		HL_DEFINE_GETSET(unsigned char, colorBottomRight.r, RedBottomRight);
-		HL_DEFINE_GETSET(unsigned char, colorBottomRight.g, GreenBottomRight);
-		HL_DEFINE_GETSET(unsigned char, colorBottomRight.b, BlueBottomRight);
-		HL_DEFINE_GETSET(unsigned char, colorBottomRight.a, AlphaBottomRight);
-		HL_DEFINE_ISSET(useAdditionalColors, UseAdditionalColors);
+		HL_DEFINE_GET(unsigned char, colorBottomRight.r, RedBottomRight);
+		void setRedBottomRight(const unsigned char& value);
+		HL_DEFINE_GET(unsigned char, colorBottomRight.g, GreenBottomRight);
+		void setGreenBottomRight(const unsigned char& value);
+		HL_DEFINE_GET(unsigned char, colorBottomRight.b, BlueBottomRight);
+		void setBlueBottomRight(const unsigned char& value);
+		HL_DEFINE_GET(unsigned char, colorBottomRight.a, AlphaBottomRight);
+		void setAlphaBottomRight(const unsigned char& value);
+		HL_DEFINE_IS(useAdditionalColors, UseAdditionalColors);
+		void setUseAdditionalColors(const bool& value);
 
 	protected:
 		april::Color colorTopRight;
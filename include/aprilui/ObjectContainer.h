@@ -39,13 +39,13 @@ namespace aprilui
 		inline hstr getClassName() const { return "Container"; }
 		static Object* createInstance(chstr name);
 
-		void notifyEvent(chstr type, EventArgs* args);
-		
 	protected:
 		ScrollArea* scrollArea;
 		ScrollBarH* scrollBarH;
 		ScrollBarV* scrollBarV;
 
+		void _notifyEvent(int typeId, EventArgs* args);
+
 	};
 
 }
@@ -38,31 +38,38 @@ namespace aprilui
 		Object* getParent() const;
 		Dataset* getDataset() const;
 		bool isCursorInside() const;
+		int64_t getByteSize() const;
 
 		HL_DEFINE_GET(hstr, emptyText, EmptyText);
 		void setEmptyText(chstr value);
 		HL_DEFINE_GET(hstr, emptyTextKey, EmptyTextKey);
 		void setEmptyTextKey(chstr value);
-		HL_DEFINE_GETSET(april::Color, emptyTextColor, EmptyTextColor);
+		HL_DEFINE_GET(april::Color, emptyTextColor, EmptyTextColor);
+		void setEmptyTextColor(const april::Color& value);
 		void setEmptyTextSymbolicColor(chstr value);
 		HL_DEFINE_GET(int, caretIndex, CaretIndex);
 		void setCaretIndex(const int& value);
 		HL_DEFINE_GETSET(gvec2f, caretOffset, CaretOffset);
 		HL_DEFINE_GETSET(float, caretOffset.x, CaretOffsetX);
 		HL_DEFINE_GETSET(float, caretOffset.y, CaretOffsetY);
-		HL_DEFINE_GETSET(april::Color, caretColor, CaretColor);
+		HL_DEFINE_GET(april::Color, caretColor, CaretColor);
+		void setCaretColor(const april::Color& value);
 		void setCaretSymbolicColor(chstr value);
-		HL_DEFINE_ISSET(multiLine, MultiLine);
+		HL_DEFINE_IS(multiLine, MultiLine);
+		void setMultiLine(const bool& value);
 		HL_DEFINE_ISSET(selectable, Selectable);
 		HL_DEFINE_GET(int, selectionCount, SelectionCount);
 		void setSelectionCount(const int& value);
-		HL_DEFINE_GETSET(april::Color, selectionColor, SelectionColor);
+		HL_DEFINE_GET(april::Color, selectionColor, SelectionColor);
+		void setSelectionColor(const april::Color& value);
 		void setSelectionSymbolicColor(chstr value);
 		HL_DEFINE_ISSET(clipboardEnabled, ClipboardEnabled);
 		HL_DEFINE_GET(int, maxLength, MaxLength);
 		void setMaxLength(const int& value);
-		HL_DEFINE_GETSET(hstr, passwordChar, PasswordChar);
-		HL_DEFINE_ISSET(disabledOffset, DisabledOffset);
+		HL_DEFINE_GET(hstr, passwordChar, PasswordChar);
+		void setPasswordChar(chstr value);
+		HL_DEFINE_IS(disabledOffset, DisabledOffset);
+		void setDisabledOffset(const bool& value);
 		HL_DEFINE_GET(hstr, filter, Filter);
 		void setFilter(chstr value);
 		HL_DEFINE_GET(grectf, caretRect, CaretRect);
@@ -75,14 +82,18 @@ namespace aprilui
 		bool isPointInside(cgvec2f position) const;
 		void setCaretIndexAt(cgvec2f position);
 
-		void notifyEvent(chstr type, EventArgs* args);
-
 		bool triggerEvent(chstr type, april::Key keyCode);
 		bool triggerEvent(chstr type, april::Key keyCode, chstr string);
 		bool triggerEvent(chstr type, april::Key keyCode, cgvec2f position, chstr string = "", void* userData = NULL);
 		bool triggerEvent(chstr type, april::Button buttonCode, chstr string = "", void* userData = NULL);
 		bool triggerEvent(chstr type, chstr string, void* userData = NULL);
 		bool triggerEvent(chstr type, void* userData = NULL);
+		bool triggerEvent(int typeId, april::Key keyCode);
+		bool triggerEvent(int typeId, april::Key keyCode, chstr string);
+		bool triggerEvent(int typeId, april::Key keyCode, cgvec2f position, chstr string = "", void* userData = NULL);
+		bool triggerEvent(int typeId, april::Button buttonCode, chstr string = "", void* userData = NULL);
+		bool triggerEvent(int typeId, chstr string, void* userData = NULL);
+		bool triggerEvent(int typeId, void* userData = NULL);
 
 		static hstr defaultFilterUnsignedNumeric;
 		static hstr defaultFilterUnsignedDecimal;
@@ -133,6 +144,7 @@ namespace aprilui
 		bool _mouseUp(april::Key keyCode);
 		void _mouseCancel(april::Key keyCode);
 		bool _mouseMove();
+		bool _isTrackingPointer() const;
 		bool _keyDown(april::Key keyCode);
 		bool _keyUp(april::Key keyCode);
 		bool _char(unsigned int charCode);
@@ -159,6 +171,7 @@ namespace aprilui
 		void _cutText();
 		void _copyText();
 		void _pasteText();
+		void _notifyEvent(int typeId, EventArgs* args);
 
 	private:
 		static hmap<hstr, PropertyDescription> _propertyDescriptions;
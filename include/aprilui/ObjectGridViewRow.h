@@ -39,12 +39,12 @@ namespace aprilui
 
 		HL_DEFINE_GET(harray<GridViewCell*>, gridViewCells, Cells);
 
-		void notifyEvent(chstr type, EventArgs* args);
-
 	protected:
 		GridView* gridView;
 		harray<GridViewCell*> gridViewCells;
 
+		void _notifyEvent(int typeId, EventArgs* args);
+
 	};
 
 }
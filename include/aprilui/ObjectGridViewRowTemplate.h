@@ -34,13 +34,12 @@ namespace aprilui
 		inline hstr getClassName() const { return "GridViewRowTemplate"; }
 		static Object* createInstance(chstr name);
 
-		void notifyEvent(chstr type, EventArgs* args);
-
 	protected:
 		void _update(float timeDelta);
 		void _draw();
 
 		GridViewRow* _createRow(chstr name);
+		void _notifyEvent(int typeId, EventArgs* args);
 
 	};
 
@@ -34,9 +34,12 @@ namespace aprilui
 		
 		hmap<hstr, PropertyDescription>& getPropertyDescriptions() const;
 
-		HL_DEFINE_GETSET(gvec2f, tileScroll, TileScroll);
-		HL_DEFINE_GETSET(float, tileScroll.x, TileScrollX);
-		HL_DEFINE_GETSET(float, tileScroll.y, TileScrollY);
+		HL_DEFINE_GET(gvec2f, tileScroll, TileScroll);
+		void setTileScroll(cgvec2f value);
+		HL_DEFINE_GET(float, tileScroll.x, TileScrollX);
+		void setTileScrollX(const float& value);
+		HL_DEFINE_GET(float, tileScroll.y, TileScrollY);
+		void setTileScrollY(const float& value);
 
 		virtual inline BaseImage* getImage() const { return this->image; }
 		virtual void setImage(BaseImage* value);
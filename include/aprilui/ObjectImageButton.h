@@ -70,14 +70,18 @@ namespace aprilui
 
 		bool isPointInside(cgvec2f position) const;
 
-		void notifyEvent(chstr type, EventArgs* args);
-		
 		bool triggerEvent(chstr type, april::Key keyCode);
 		bool triggerEvent(chstr type, april::Key keyCode, chstr string);
 		bool triggerEvent(chstr type, april::Key keyCode, cgvec2f position, chstr string = "", void* userData = NULL);
 		bool triggerEvent(chstr type, april::Button buttonCode, chstr string = "", void* userData = NULL);
 		bool triggerEvent(chstr type, chstr string, void* userData = NULL);
 		bool triggerEvent(chstr type, void* userData = NULL);
+		bool triggerEvent(int typeId, april::Key keyCode);
+		bool triggerEvent(int typeId, april::Key keyCode, chstr string);
+		bool triggerEvent(int typeId, april::Key keyCode, cgvec2f position, chstr string = "", void* userData = NULL);
+		bool triggerEvent(int typeId, april::Button buttonCode, chstr string = "", void* userData = NULL);
+		bool triggerEvent(int typeId, chstr string, void* userData = NULL);
+		bool triggerEvent(int typeId, void* userData = NULL);
 
 	protected:
 		BaseImage* normalImage;
@@ -106,12 +110,14 @@ namespace aprilui
 		bool _mouseUp(april::Key keyCode);
 		void _mouseCancel(april::Key keyCode);
 		bool _mouseMove();
+		bool _isTrackingPointer() const;
 		bool _touchDown(int index);
 		bool _touchUp(int index);
 		void _touchCancel(int index);
 		bool _touchMove(int index);
 		bool _buttonDown(april::Button buttonCode);
 		bool _buttonUp(april::Button buttonCode);
+		void _notifyEvent(int typeId, EventArgs* args);
 		
 	private:
 		float _hoverAddTime;
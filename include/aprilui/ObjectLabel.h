@@ -35,24 +35,31 @@ namespace aprilui
 
 		Dataset* getDataset() const;
 		hstr getAutoScaledFont();
+		int64_t getByteSize() const;
 
 		hstr getProperty(chstr name);
 		bool setProperty(chstr name, chstr value);
 
-		void notifyEvent(chstr type, EventArgs* args);
-
 		bool triggerEvent(chstr type, april::Key keyCode);
 		bool triggerEvent(chstr type, april::Key keyCode, chstr string);
 		bool triggerEvent(chstr type, april::Key keyCode, cgvec2f position, chstr string = "", void* userData = NULL);
 		bool triggerEvent(chstr type, april::Button buttonCode, chstr string = "", void* userData = NULL);
 		bool triggerEvent(chstr type, chstr string, void* userData = NULL);
 		bool triggerEvent(chstr type, void* userData = NULL);
+		bool triggerEvent(int typeId, april::Key keyCode);
+		bool triggerEvent(int typeId, april::Key keyCode, chstr string);
+		bool triggerEvent(int typeId, april::Key keyCode, cgvec2f position, chstr string = "", void* userData = NULL);
+		bool triggerEvent(int typeId, april::Button buttonCode, chstr string = "", void* userData = NULL);
+		bool triggerEvent(int typeId, chstr string, void* userData = NULL);
+		bool triggerEvent(int typeId, void* userData = NULL);
 
 	protected:
 		void _draw();
+		grectf _makeDrawBounds();
 
 		hmap<hstr, PropertyDescription::Accessor*>& _getGetters() const;
 		hmap<hstr, PropertyDescription::Accessor*>& _getSetters() const;
+		void _notifyEvent(int typeId, EventArgs* args);
 
 	private:
 		static hmap<hstr, PropertyDescription> _propertyDescriptions;
@@ -52,8 +52,10 @@ namespace aprilui
 		void setTextKey(chstr value);
 		HL_DEFINE_GET(hstr, font, Font);
 		void setFont(chstr value);
-		HL_DEFINE_ISSET(textFormatting, TextFormatting);
-		HL_DEFINE_GETSET(april::Color, textColor, TextColor);
+		HL_DEFINE_IS(textFormatting, TextFormatting);
+		void setTextFormatting(const bool& value);
+		HL_DEFINE_GET(april::Color, textColor, TextColor);
+		void setTextColor(const april::Color& value);
 		void setTextSymbolicColor(chstr value);
 		HL_DEFINE_GET(gvec2f, textOffset, TextOffset);
 		void setTextOffset(cgvec2f value);
@@ -67,47 +69,71 @@ namespace aprilui
 		void setHorzFormatting(const atres::Horizontal& value);
 		HL_DEFINE_GET(atres::Vertical, vertFormatting, VertFormatting);
 		void setVertFormatting(const atres::Vertical& value);
-		HL_DEFINE_GETSET(atres::TextEffect, effect, Effect);
+		HL_DEFINE_GET(atres::TextEffect, effect, Effect);
+		void setEffect(const atres::TextEffect& value);
 		HL_DEFINE_GET(CaseMode, caseMode, CaseMode);
 		void setCaseMode(const CaseMode& value);
-		HL_DEFINE_ISSET(useEffectColor, UseEffectColor);
-		HL_DEFINE_ISSET(useEffectParameter, UseEffectParameter);
-		HL_DEFINE_GETSET(april::Color, effectColor, EffectColor);
+		HL_DEFINE_IS(useEffectColor, UseEffectColor);
+		void setUseEffectColor(const bool& value);
+		HL_DEFINE_IS(useEffectParameter, UseEffectParameter);
+		void setUseEffectParameter(const bool& value);
+		HL_DEFINE_GET(april::Color, effectColor, EffectColor);
+		void setEffectColor(const april::Color& value);
 		void setEffectSymbolicColor(chstr value);
-		HL_DEFINE_GETSET(hstr, effectParameter, EffectParameter);
-		HL_DEFINE_GETSET(april::Color, backgroundColor, BackgroundColor);
+		HL_DEFINE_GET(hstr, effectParameter, EffectParameter);
+		void setEffectParameter(chstr value);
+		HL_DEFINE_GET(april::Color, backgroundColor, BackgroundColor);
+		void setBackgroundColor(const april::Color& value);
 		void setBackgroundSymbolicColor(chstr value);
-		HL_DEFINE_ISSET(strikeThrough, StrikeThrough);
-		HL_DEFINE_ISSET(useStrikeThroughColor, UseStrikeThroughColor);
-		HL_DEFINE_ISSET(useStrikeThroughParameter, UseStrikeThroughParameter);
-		HL_DEFINE_GETSET(april::Color, strikeThroughColor, StrikeThroughColor);
+		HL_DEFINE_IS(strikeThrough, StrikeThrough);
+		void setStrikeThrough(const bool& value);
+		HL_DEFINE_IS(useStrikeThroughColor, UseStrikeThroughColor);
+		void setUseStrikeThroughColor(const bool& value);
+		HL_DEFINE_IS(useStrikeThroughParameter, UseStrikeThroughParameter);
+		void setUseStrikeThroughParameter(const bool& value);
+		HL_DEFINE_GET(april::Color, strikeThroughColor, StrikeThroughColor);
+		void setStrikeThroughColor(const april::Color& value);
 		void setStrikeThroughSymbolicColor(chstr value);
-		HL_DEFINE_GETSET(hstr, strikeThroughParameter, StrikeThroughParameter);
-		HL_DEFINE_ISSET(underline, Underline);
-		HL_DEFINE_ISSET(useUnderlineColor, UseUnderlineColor);
-		HL_DEFINE_ISSET(useUnderlineParameter, UseUnderlineParameter);
-		HL_DEFINE_GETSET(april::Color, underlineColor, UnderlineColor);
+		HL_DEFINE_GET(hstr, strikeThroughParameter, StrikeThroughParameter);
+		void setStrikeThroughParameter(chstr value);
+		HL_DEFINE_IS(underline, Underline);
+		void setUnderline(const bool& value);
+		HL_DEFINE_IS(useUnderlineColor, UseUnderlineColor);
+		void setUseUnderlineColor(const bool& value);
+		HL_DEFINE_IS(useUnderlineParameter, UseUnderlineParameter);
+		void setUseUnderlineParameter(const bool& value);
+		HL_DEFINE_GET(april::Color, underlineColor, UnderlineColor);
+		void setUnderlineColor(const april::Color& value);
 		void setUnderlineSymbolicColor(chstr value);
-		HL_DEFINE_GETSET(hstr, underlineParameter, UnderlineParameter);
-		HL_DEFINE_ISSET(italic, Italic);
-		HL_DEFINE_ISSET(backgroundBorder, BackgroundBorder);
+		HL_DEFINE_GET(hstr, underlineParameter, UnderlineParameter);
+		void setUnderlineParameter(chstr value);
+		HL_DEFINE_IS(italic, Italic);
+		void setItalic(const bool& value);
+		HL_DEFINE_IS(backgroundBorder, BackgroundBorder);
+		void setBackgroundBorder(const bool& value);
 
 		virtual Dataset* getDataset() const = 0;
 		virtual hstr getAutoScaledFont() = 0;
 
 		bool trySetTextKey(chstr textKey);
+		/// @return Approximate CPU memory used by the text, text key, fonts and formatting parameters in bytes.
+		virtual int64_t getByteSize() const;
 		
 		hstr getProperty(chstr name);
 		bool setProperty(chstr name, chstr value);
 
-		virtual void notifyEvent(chstr type, EventArgs* args);
-
 		virtual bool triggerEvent(chstr type, april::Key keyCode) = 0;
 		virtual bool triggerEvent(chstr type, april::Key keyCode, chstr string) = 0;
 		virtual bool triggerEvent(chstr type, april::Key keyCode, cgvec2f position, chstr string = "", void* userData = NULL) = 0;
 		virtual bool triggerEvent(chstr type, april::Button buttonCode, chstr string = "", void* userData = NULL) = 0;
 		virtual bool triggerEvent(chstr type, chstr string, void* userData = NULL) = 0;
 		virtual bool triggerEvent(chstr type, void* userData = NULL) = 0;
+		virtual bool triggerEvent(int typeId, april::Key keyCode) = 0;
+		virtual bool triggerEvent(int typeId, april::Key keyCode, chstr string) = 0;
+		virtual bool triggerEvent(int typeId, april::Key keyCode, cgvec2f position, chstr string = "", void* userData = NULL) = 0;
+		virtual bool triggerEvent(int typeId, april::Button buttonCode, chstr string = "", void* userData = NULL) = 0;
+		virtual bool triggerEvent(int typeId, chstr string, void* userData = NULL) = 0;
+		virtual bool triggerEvent(int typeId, void* userData = NULL) = 0;
 
 		static float defaultMinAutoScale;
 
@@ -141,13 +167,20 @@ namespace aprilui
 		bool italic;
 		april::Color backgroundColor;
 		bool backgroundBorder;
+		/// @brief Text bounds relative to the draw rect from the last time the bounds were recorded.
+		grectf _textDrawBounds;
 
 		void _calcAutoScaledFont(cgrectf rect);
+		void _requestTextRedraw();
 		april::Color _makeBackgroundDrawColor(const april::Color& drawColor) const;
 		bool _analyzeExtraParameters(chstr name, chstr value, bool& useColor, bool& useParameter, april::Color& color, hstr& parameter) const;
 		
 		void _drawLabelBackground(cgrectf rect, const april::Color& color, const april::Color& backgroundColor);
 		void _drawLabel(cgrectf rect, const april::Color& color);
+		/// @brief Extends rect so it covers text that overflows it and text effects.
+		grectf _makeTextDrawBounds(cgrectf rect);
+
+		virtual void _notifyEvent(int typeId, EventArgs* args);
 
 		template <typename T>
 		static hmap<hstr, PropertyDescription::Accessor*> _generateGetters()
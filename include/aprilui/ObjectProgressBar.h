@@ -48,8 +48,10 @@ namespace aprilui
 		
 		hmap<hstr, PropertyDescription>& getPropertyDescriptions() const;
 
-		HL_DEFINE_ISSET(stretching, Stretching);
-		HL_DEFINE_GETSET(Direction, direction, Direction);
+		HL_DEFINE_IS(stretching, Stretching);
+		void setStretching(const bool& value);
+		HL_DEFINE_GET(Direction, direction, Direction);
+		void setDirection(const Direction& value);
 		HL_DEFINE_ISSET(interactable, Interactable);
 		Dataset* getDataset() const;
 		BaseImage* getImage() const;
@@ -83,6 +85,7 @@ namespace aprilui
 		bool _mouseUp(april::Key keyCode);
 		void _mouseCancel(april::Key keyCode);
 		bool _mouseMove();
+		bool _isTrackingPointer() const;
 
 		void _updateInteractablePosition();
 
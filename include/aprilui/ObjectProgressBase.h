@@ -40,10 +40,14 @@ namespace aprilui
 		HL_DEFINE_GET(hstr, progressImageName, ProgressImageName);
 		HL_DEFINE_GET(hstr, antiProgressImageName, AntiProgressImageName);
 		HL_DEFINE_GET(hstr, maskImageName, MaskImageName);
-		HL_DEFINE_GETSET(float, progress, Progress);
-		HL_DEFINE_GETSET(april::Color, progressColor, ProgressColor);
-		HL_DEFINE_GETSET(april::Color, antiProgressColor, AntiProgressColor);
-		HL_DEFINE_GETSET(april::Color, maskColor, MaskColor);
+		HL_DEFINE_GET(float, progress, Progress);
+		void setProgress(const float& value);
+		HL_DEFINE_GET(april::Color, progressColor, ProgressColor);
+		void setProgressColor(const april::Color& value);
+		HL_DEFINE_GET(april::Color, antiProgressColor, AntiProgressColor);
+		void setAntiProgressColor(const april::Color& value);
+		HL_DEFINE_GET(april::Color, maskColor, MaskColor);
+		void setMaskColor(const april::Color& value);
 		void setProgressImage(BaseImage* image);
 		void setAntiProgressImage(BaseImage* image);
 		void setMaskImage(BaseImage* image);
@@ -88,6 +92,7 @@ namespace aprilui
 		april::Color _makeDrawProgressColor() const;
 		april::Color _makeDrawAntiProgressColor() const;
 		april::Color _makeDrawMaskColor() const;
+		void _requestProgressRedraw();
 		
 		virtual harray<BaseImage*> _getUsedImages() const;
 
@@ -50,7 +50,8 @@ namespace aprilui
 		
 		hmap<hstr, PropertyDescription>& getPropertyDescriptions() const;
 
-		HL_DEFINE_GETSET(Direction, direction, Direction);
+		HL_DEFINE_GET(Direction, direction, Direction);
+		void setDirection(const Direction& value);
 		Dataset* getDataset() const;
 		BaseImage* getImage() const;
 		void setImage(BaseImage* image);
@@ -54,8 +54,6 @@ namespace aprilui
 		HL_DEFINE_GET(hstr, skinName, SkinName);
 		void setSkinName(chstr value);
 
-		void notifyEvent(chstr type, EventArgs* args);
-
 		virtual void addScrollValue(float value) = 0;
 		void addScrollValueBackground(float value);
 		void addScrollValueForward(float multiplier = 1.0f);
@@ -133,6 +131,7 @@ namespace aprilui
 		void _updateButtonBackwardSkinned();
 
 		bool _mouseMove();
+		void _notifyEvent(int typeId, EventArgs* args);
 
 	private:
 		static hmap<hstr, PropertyDescription> _propertyDescriptions;
@@ -30,10 +30,9 @@ namespace aprilui
 		inline hstr getClassName() const { return "ScrollBarButtonForward"; }
 		static Object* createInstance(chstr name);
 
-		void notifyEvent(chstr type, EventArgs* args);
-
 	protected:
 		static void _click(EventArgs* args);
+		void _notifyEvent(int typeId, EventArgs* args);
 
 	};
 
@@ -30,11 +30,10 @@ namespace aprilui
 		inline hstr getClassName() const { return "ScrollBarButtonSlider"; }
 		static Object* createInstance(chstr name);
 
-		void notifyEvent(chstr type, EventArgs* args);
-
 	protected:
 		static void _mouseDown(EventArgs* args);
 		static void _click(EventArgs* args);
+		void _notifyEvent(int typeId, EventArgs* args);
 
 	};
 
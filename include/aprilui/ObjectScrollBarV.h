@@ -33,8 +33,6 @@ namespace aprilui
 		inline hstr getClassName() const { return "ScrollBarV"; }
 		static Object* createInstance(chstr name);
 
-		void notifyEvent(chstr type, EventArgs* args);
-
 		void addScrollValue(float value);
 
 		static hstr skinNameVBackground;
@@ -69,6 +67,7 @@ namespace aprilui
 		void _updateBar();
 		void _adjustDragSpeed();
 		bool _checkAreaSize();
+		void _notifyEvent(int typeId, EventArgs* args);
 
 	};
 
@@ -55,8 +55,6 @@ namespace aprilui
 
 		virtual int getItemCount() const = 0;
 
-		void notifyEvent(chstr type, EventArgs* args);
-
 	protected:
 		int selectedIndex;
 		float itemHeight;
@@ -75,6 +73,7 @@ namespace aprilui
 		virtual void _updateDisplay() = 0;
 		virtual void _updateItem(int index) = 0;
 		virtual void _optimizeVisibility();
+		void _notifyEvent(int typeId, EventArgs* args);
 
 	private:
 		static hmap<hstr, PropertyDescription> _propertyDescriptions;
@@ -44,18 +44,23 @@ namespace aprilui
 		void setDisabledTextSymbolicColor(chstr value);
 		Dataset* getDataset() const;
 		hstr getAutoScaledFont();
+		int64_t getByteSize() const;
 
 		hstr getProperty(chstr name);
 		bool setProperty(chstr name, chstr value);
 
-		void notifyEvent(chstr type, EventArgs* args);
-
 		bool triggerEvent(chstr type, april::Key keyCode);
 		bool triggerEvent(chstr type, april::Key keyCode, chstr string);
 		bool triggerEvent(chstr type, april::Key keyCode, cgvec2f position, chstr string = "", void* userData = NULL);
 		bool triggerEvent(chstr type, april::Button buttonCode, chstr string = "", void* userData = NULL);
 		bool triggerEvent(chstr type, chstr string, void* userData = NULL);
 		bool triggerEvent(chstr type, void* userData = NULL);
+		bool triggerEvent(int typeId, april::Key keyCode);
+		bool triggerEvent(int typeId, april::Key keyCode, chstr string);
+		bool triggerEvent(int typeId, april::Key keyCode, cgvec2f position, chstr string = "", void* userData = NULL);
+		bool triggerEvent(int typeId, april::Button buttonCode, chstr string = "", void* userData = NULL);
+		bool triggerEvent(int typeId, chstr string, void* userData = NULL);
+		bool triggerEvent(int typeId, void* userData = NULL);
 
 	protected:
 		april::Color pushedTextColor;
@@ -66,6 +71,8 @@ namespace aprilui
 		hmap<hstr, PropertyDescription::Accessor*>& _getSetters() const;
 
 		void _draw();
+		grectf _makeDrawBounds();
+		void _notifyEvent(int typeId, EventArgs* args);
 
 	private:
 		static hmap<hstr, PropertyDescription> _propertyDescriptions;
@@ -31,7 +31,8 @@ namespace aprilui
 
 		hmap<hstr, PropertyDescription>& getPropertyDescriptions() const;
 
-		HL_DEFINE_ISSET(toggled, Toggled);
+		HL_DEFINE_IS(toggled, Toggled);
+		void setToggled(const bool& value);
 		HL_DEFINE_GET(BaseImage*, toggledNormalImage, ToggledNormalImage);
 		HL_DEFINE_GET(BaseImage*, toggledPushedImage, ToggledPushedImage);
 		HL_DEFINE_GET(BaseImage*, toggledHoverImage, ToggledHoverImage);
@@ -35,7 +35,8 @@ namespace aprilui
 		inline hstr getClassName() const { return "TreeViewLabel"; }
 		static Object* createInstance(chstr name);
 
-		void notifyEvent(chstr type, EventArgs* args);
+	protected:
+		void _notifyEvent(int typeId, EventArgs* args);
 
 	private:
 		TreeView* _treeView;
@@ -16,8 +16,10 @@
 #include <april/april.h>
 #include <april/aprilUtil.h>
 #include <april/Color.h>
+#include <hltypes/harray.h>
 #include <hltypes/henum.h>
 #include <hltypes/hltypesUtil.h>
+#include <hltypes/hmap.h>
 #include <hltypes/hstring.h>
 #include <gtypes/Rectangle.h>
 #include <gtypes/Vector2.h>
@@ -34,6 +36,12 @@
 		inline Get ## name(type (O::*function)() const) : Accessor() { this->function = function; } \
 		inline Get ## name(type (O::*function)()) : Accessor() { this->function = function; } \
 		inline void execute(void* object, hstr& parameter) const { const type& result = (((O*)object)->*this->function)(); parameter = conversionCode; } \
+		inline bool executeTyped(void* object, void* value, const Type& valueType) const \
+		{ \
+			if (!_isType((type*)NULL, valueType)) return false; \
+			*(type*)value = (((O*)object)->*this->function)(); \
+			return true; \
+		} \
 	};
 
 #define _DEFINE_SPECIAL_SET_CLASS(name, type, conversionCode) \
@@ -44,6 +52,12 @@
 		void (O::*function)(const type&); \
 		inline Set ## name(void (O::*function)(const type&)) : Accessor() { this->function = function; } \
 		inline void execute(void* object, hstr& parameter) const { const type& converted = conversionCode; (((O*)object)->*this->function)(converted); } \
+		inline bool executeTyped(void* object, void* value, const Type& valueType) const \
+		{ \
+			if (!_isType((type*)NULL, valueType)) return false; \
+			(((O*)object)->*this->function)(*(const type*)value); \
+			return true; \
+		} \
 	};
 
 namespace aprilui
@@ -73,9 +87,27 @@ namespace aprilui
 			inline Accessor() { }
 
 			virtual void execute(void* object, hstr& parameter) const = 0;
+			/// @brief Executes the accessor with a raw value instead of a string.
+			/// @param[in] object The object.
+			/// @param[in,out] value Pointer to the value.
+			/// @param[in] valueType The type of the value.
+			/// @return True if the accessor supports the given value type directly.
+			/// @note If this returns false, nothing was executed and the string version should be used instead.
+			virtual inline bool executeTyped(void* object, void* value, const Type& valueType) const { return false; }
 
 		};
 
+		/// @brief Used to check if a C++ type can be passed to an accessor directly as the given property type.
+		template <typename T>
+		static inline bool _isType(T* dummy, const Type& valueType) { return false; }
+		static inline bool _isType(int* dummy, const Type& valueType) { return (valueType == Type::Int); }
+		static inline bool _isType(float* dummy, const Type& valueType) { return (valueType == Type::Float); }
+		static inline bool _isType(bool* dummy, const Type& valueType) { return (valueType == Type::Bool); }
+		static inline bool _isType(gvec2f* dummy, const Type& valueType) { return (valueType == Type::Gvec2f); }
+		static inline bool _isType(gvec3f* dummy, const Type& valueType) { return (valueType == Type::Gvec3f); }
+		static inline bool _isType(grectf* dummy, const Type& valueType) { return (valueType == Type::Grectf); }
+		static inline bool _isType(april::Color* dummy, const Type& valueType) { return (valueType == Type::Color); }
+
 		template <typename O, typename T>
 		class Get : public Accessor
 		{
@@ -84,6 +116,15 @@ namespace aprilui
 			inline Get(T (O::*function)() const) : Accessor() { this->function = (T (O::*)())function; }
 
 			inline void execute(void* object, hstr& parameter) const { parameter = (((O*)object)->*this->function)(); }
+			inline bool executeTyped(void* object, void* value, const Type& valueType) const
+			{
+				if (!_isType((T*)NULL, valueType))
+				{
+					return false;
+				}
+				*(T*)value = (((O*)object)->*this->function)();
+				return true;
+			}
 
 		protected:
 			T (O::*function)();
@@ -97,6 +138,15 @@ namespace aprilui
 			inline _SetBase(R (O::*function)(const T&)) : Accessor() { this->function = function; }
 
 			inline void execute(void* object, hstr& parameter) const { (((O*)object)->*this->function)((T)parameter); }
+			inline bool executeTyped(void* object, void* value, const Type& valueType) const
+			{
+				if (!_isType((T*)NULL, valueType))
+				{
+					return false;
+				}
+				(((O*)object)->*this->function)(*(const T*)value);
+				return true;
+			}
 
 		protected:
 			R (O::*function)(const T&);
@@ -136,13 +186,36 @@ namespace aprilui
 		HL_DEFINE_GET(Type, type, Type);
 		HL_DEFINE_IS(arrayData, ArrayData);
 
+		/// @brief Gets the unique ID of a property name.
+		/// @param[in] name The property name.
+		/// @return The unique ID of the property name.
+		/// @note IDs are global and the same for all classes. The name is registered if it wasn't registered before.
+		static int findId(chstr name);
+		/// @brief Gets the property name for a property ID.
+		/// @param[in] id The property ID.
+		/// @return The property name or an empty string if the ID is not registered.
+		static hstr findNameById(int id);
+		/// @brief Gets an ID-indexed lookup table for an accessor map.
+		/// @param[in] accessors The accessor map, usually a static getter/setter map of an object class.
+		/// @return The lookup table where the index is the property ID.
+		/// @note The table is built only once per accessor map and all its property names are registered.
+		static const harray<Accessor*>& getAccessorTable(hmap<hstr, Accessor*>& accessors);
+
 	protected:
 		hstr name;
 		Type type;
 		bool arrayData;
 
+	private:
+		static hmap<hstr, int> _ids;
+		static harray<hstr> _names;
+		static hmap<hmap<hstr, Accessor*>*, harray<Accessor*> > _accessorTables;
+
+		static int _findId(chstr name);
+
 	};
 
+
 }
 
 #undef _DEFINE_SPECIAL_GET_CLASS
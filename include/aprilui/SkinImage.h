@@ -57,8 +57,11 @@ namespace aprilui
 		HL_DEFINE_IS(tiledBorders, TiledBorders);
 		void setTiledBorders(const bool& value);
 
+		int64_t getCacheByteSize() const;
+
 		void draw(cgrectf rect, const april::Color& color = april::Color::White);
 		void draw(const harray<april::TexturedVertex>& vertices, const april::Color& color = april::Color::White);
+		void drawClipped(cgrectf rect, cgrectf clipRect, const april::Color& color = april::Color::White);
 		
 		static int maxRectCache;
 
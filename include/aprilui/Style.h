@@ -30,6 +30,8 @@ namespace aprilui
 	public:
 		friend class Dataset;
 
+		typedef std::pair<hstr, hstr> PropertyValue;
+
 		class apriluiExport Group
 		{
 		public:
@@ -40,12 +42,20 @@ namespace aprilui
 		};
 
 		Style(chstr name = "");
+		~Style();
 
 		HL_DEFINE_GET(hstr, name, Name);
 		HL_DEFINE_GET(Dataset*, dataset, Dataset);
 		hstr getFullName() const;
+		/// @return Approximate CPU memory used by this style and its cached properties in bytes.
+		int64_t getByteSize() const;
 
 		hmap<hstr, hstr> findProperties(chstr className);
+		/// @brief Gets the properties for a class with the defaults already merged in.
+		/// @param[in] className Name of the object or animator class.
+		/// @return Array of properties that can be applied in order.
+		/// @note The result is cached until the style changes.
+		const harray<PropertyValue>& findFlattenedProperties(chstr className);
 
 	protected:
 		hstr name;
@@ -57,6 +67,16 @@ namespace aprilui
 
 		void _inject(Style* other);
 		Style* _injected(Style* other);
+		/// @note The returned Style is owned by this Style and must not be destroyed.
+		Style* _findInjected(Style* other);
+		void _invalidateCache();
+
+	private:
+		int _revision;
+		hmap<hstr, harray<PropertyValue> > _flattenedProperties;
+		hmap<Style*, std::pair<int, Style*> > _injectedStyles;
+
+		void _clearInjectedStyles();
 
 	};
 
@@ -31,6 +31,9 @@ namespace aprilui
 		Texture(chstr name, chstr filename, april::Texture* texture, bool managed = false);
 		~Texture();
 
+		/// @brief Stable identifier of the texture in the global texture registry that is never reused for another texture.
+		/// @see aprilui::getTextureByHandle()
+		HL_DEFINE_GET(int64_t, handle, Handle);
 		HL_DEFINE_GET(hstr, name, Name);
 		HL_DEFINE_GET(hstr, originalFilename, OriginalFilename);
 		HL_DEFINE_GET(hstr, filename, Filename);
@@ -40,8 +43,10 @@ namespace aprilui
 		HL_DEFINE_IS(managed, Managed);
 		HL_DEFINE_GET(gvec2f, scale, Scale);
 		HL_DEFINE_GET(Dataset*, dataset, Dataset);
-		HL_DEFINE_GET(float, unusedTime, UnusedTime);
+		/// @return Time since the texture was last loaded or used as measured by Dataset::updateTextures().
+		float getUnusedTime() const;
 		HL_DEFINE_GET(harray<Texture*>, links, Links);
+		HL_DEFINE_GET(int64_t, lastUsage, LastUsage);
 		int getWidth() const;
 		int getHeight() const;
 		bool isUploaded() const;
@@ -49,11 +54,18 @@ namespace aprilui
 		bool isAsyncLoadQueued() const;
 		bool isUnloaded() const;
 		bool isValid() const;
+		/// @return Approximate memory size of the texture data in bytes or 0 if the texture is not loaded.
+		int64_t getByteSize() const;
 		void setFilter(april::Texture::Filter value);
 		void setAddressMode(april::Texture::AddressMode value);
 
+		/// @brief Checks the state of an asynchronous load.
+		/// @note Idle unloading is handled by the dataset through deadlines so this is only called while the texture is loading.
 		void update(float timeDelta);
 		void resetUnusedTime();
+		/// @brief Marks the texture as most recently used for the texture memory budget.
+		/// @see aprilui::setTextureMemoryBudget()
+		void markUsed();
 
 		bool loadMetaData(bool ignoreDynamicLinks = false);
 		bool load(bool ignoreDynamicLinks = false);
@@ -65,6 +77,7 @@ namespace aprilui
 		void removeLink(Texture* link);
 		
 	protected:
+		int64_t handle;
 		hstr name;
 		hstr originalFilename;
 		hstr filename;
@@ -76,7 +89,18 @@ namespace aprilui
 		gvec2f scale;
 		Dataset* dataset;
 		harray<Texture*> links;
-		float unusedTime;
+		int64_t lastUsage;
+
+	private:
+		bool _readyForUpload;
+		double _idleStartTime;
+		bool _idleScheduled;
+		bool _loadPending;
+		int64_t _byteSize; // the size currently counted in the global texture memory usage
+
+		void _resetIdleTime();
+		void _markLoadPending();
+		void _updateByteSize();
 
 	};
 
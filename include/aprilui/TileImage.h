@@ -44,8 +44,11 @@ namespace aprilui
 		HL_DEFINE_GETSET(float, scroll.y, ScrollY);
 		HL_DEFINE_ISSET(useTileCount, UseTileCount);
 
+		int64_t getCacheByteSize() const;
+
 		void draw(cgrectf rect, const april::Color& color = april::Color::White);
 		void draw(const harray<april::TexturedVertex>& vertices, const april::Color& color = april::Color::White);
+		void drawClipped(cgrectf rect, cgrectf clipRect, const april::Color& color = april::Color::White);
 
 	protected:
 		gvec2f tile;
@@ -62,6 +62,50 @@ namespace aprilui
 	apriluiFnExport void setSupportedLocalizations(const harray<hstr>& value);
 	apriluiFnExport float getTextureIdleUnloadTime();
 	apriluiFnExport void setTextureIdleUnloadTime(float value);
+	/// @brief Gets the memory budget for all textures in bytes.
+	/// @return The memory budget in bytes or 0 if there is no budget.
+	apriluiFnExport int64_t getTextureMemoryBudget();
+	/// @brief Sets the memory budget for all textures in bytes.
+	/// @param[in] value The memory budget in bytes. Use 0 to disable the budget.
+	/// @note When the budget is exceeded, the least recently used managed textures of all datasets are unloaded in updateTextures().
+	apriluiFnExport void setTextureMemoryBudget(int64_t value);
+	/// @return The approximate memory currently used by all loaded textures in bytes.
+	apriluiFnExport int64_t getTextureMemoryUsage();
+	/// @brief Gets the per-frame budget for prefetching textures.
+	/// @return The approximate texture data size in bytes that may start loading per frame or 0 if there is no limit.
+	apriluiFnExport int64_t getTexturePrefetchBudget();
+	/// @brief Sets the per-frame budget for prefetching textures.
+	/// @param[in] value The approximate texture data size in bytes that may start loading per frame. Use 0 to start all queued loads at once.
+	/// @note At least one queued texture is always started per frame so large textures cannot block the queue.
+	/// @see Dataset::prefetchTextures()
+	apriluiFnExport void setTexturePrefetchBudget(int64_t value);
+	/// @brief Gets the per-frame budget for uploading textures when they are drawn.
+	/// @return The approximate texture data size in bytes that may be uploaded per frame or 0 if there is no limit.
+	apriluiFnExport int64_t getTextureUploadBudget();
+	/// @brief Sets the per-frame budget for uploading textures when they are drawn.
+	/// @param[in] value The approximate texture data size in bytes that may be uploaded per frame. Use 0 to disable the budget.
+	/// @note Textures that exceed the budget are queued and uploaded in the following frames. Textures that were already waiting have priority
+	/// and textures that are not drawn anymore are dropped from the queue. At least one texture is uploaded per frame. The frame ends in updateTextures().
+	apriluiFnExport void setTextureUploadBudget(int64_t value);
+	/// @brief Gets the texture drawn instead of textures waiting for their upload.
+	/// @return The placeholder texture or NULL if images with waiting textures are not drawn at all.
+	apriluiFnExport Texture* getTextureUploadPlaceholder();
+	/// @brief Sets the texture drawn instead of textures waiting for their upload.
+	/// @param[in] value The placeholder texture or NULL to not draw images with waiting textures.
+	/// @note The placeholder is drawn with the texture coordinates of the image so a small texture with a uniform color works best.
+	apriluiFnExport void setTextureUploadPlaceholder(Texture* value);
+	/// @return The number of textures waiting to be uploaded.
+	apriluiFnExport int getPendingTextureUploadCount();
+	/// @brief Gets the size of texture atlas pages that are built when loading datasets.
+	/// @return The width and height of atlas pages in pixels or 0 if no atlases are built.
+	apriluiFnExport int getTextureAtlasPageSize();
+	/// @brief Sets the size of texture atlas pages that are built when loading datasets.
+	/// @param[in] value The width and height of atlas pages in pixels. Use 0 to disable building of atlases.
+	/// @note Small textures of a texture group or of the rest of a dataset are packed into shared pages so images using them can be batched.
+	apriluiFnExport void setTextureAtlasPageSize(int value);
+	/// @return The maximum width and height of textures that are packed into atlas pages.
+	apriluiFnExport int getTextureAtlasMaxTextureSize();
+	apriluiFnExport void setTextureAtlasMaxTextureSize(int value);
 	apriluiFnExport bool isDefaultManagedTextures();
 	apriluiFnExport void setDefaultManagedTextures(bool value);
 	apriluiFnExport april::Texture::LoadMode getDefaultTextureLoadMode();
@@ -70,6 +114,11 @@ namespace aprilui
 	apriluiFnExport void setUseKeyboardAutoOffset(bool value);
 	apriluiFnExport hmap<hstr, Dataset*> getDatasets();
 	apriluiFnExport harray<Texture*> getTextures();
+	/// @brief Gets a texture by its registry handle.
+	/// @param[in] handle The handle of the texture.
+	/// @return The texture or NULL if it has been destroyed in the meantime.
+	/// @see Texture::getHandle()
+	apriluiFnExport Texture* getTextureByHandle(int64_t handle);
 
 	apriluiFnExport void registerObjectFactory(chstr typeName, Object* (*factory)(chstr));
 	apriluiFnExport void registerAnimatorFactory(chstr typeName, Animator* (*factory)(chstr));
@@ -117,11 +166,24 @@ namespace aprilui
 	apriluiFnExport void setDebugExceptionsEnabled(bool textureFiles, bool childManipulation, bool creationFactories, bool objectExistence, bool systemConsistency);
 
 	apriluiFnExport Dataset* getDatasetByName(chstr name);
+	/// @brief Interns a name in the global name table.
+	/// @param[in] name The name.
+	/// @return Compact ID of the name. IDs are never reused and stay valid until the process ends.
+	/// @note Names in the form "dataset.name" also store the IDs of their parts so lookups by ID don't have to split them again.
+	/// @note Only intern names that are actually looked up by ID, the table only grows.
+	apriluiFnExport int internName(chstr name);
+	/// @return The ID of an already interned name or 0 if the name was never interned.
+	apriluiFnExport int findNameId(chstr name);
+	/// @return The interned name with the given ID or an empty string if the ID is not valid.
+	apriluiFnExport hstr getInternedName(int nameId);
 	
 	apriluiFnExport void notifyEvent(chstr type, EventArgs* args);
 	apriluiFnExport void processEvents();
 	apriluiFnExport void update(float timeDelta);
 	apriluiFnExport void updateTextures(float timeDelta);
+	/// @brief Unloads least recently used managed textures until the texture memory budget is met.
+	/// @note Textures used since the last call are not unloaded. This is already called in updateTextures(), but can be called manually when the system is low on memory.
+	apriluiFnExport void enforceTextureMemoryBudget();
 	apriluiFnExport void clearChildUnderCursor();
 	apriluiFnExport void unloadUnusedResources();
 	apriluiFnExport void reloadTextures();
@@ -146,6 +208,14 @@ namespace aprilui
 	apriluiFnExport void onTouch(const harray<gvec2f>& touches);
 	apriluiFnExport void onButtonDown(april::Button buttonCode);
 	apriluiFnExport void onButtonUp(april::Button buttonCode);
+	/// @return Whether input events are queued and only dispatched in processInput().
+	apriluiFnExport bool isInputQueueEnabled();
+	/// @brief Sets whether input events are queued and only dispatched in processInput().
+	/// @note Consecutive mouse and touch moves of the same pointer are merged into one move while all other events keep their order.
+	apriluiFnExport void setInputQueueEnabled(bool value);
+	/// @brief Dispatches all queued input events.
+	/// @note This is already called at the beginning of update().
+	apriluiFnExport void processInput();
 
 }
 #endif
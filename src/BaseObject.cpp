@@ -6,13 +6,18 @@
 /// This program is free software; you can redistribute it and/or modify it under
 /// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
 
+#include <algorithm>
+
 #include <hltypes/harray.h>
 #include <hltypes/hstring.h>
 
 #include "Animator.h"
+#include "aprilui.h"
+#include "apriluiUtil.h"
 #include "BaseObject.h"
 #include "CallbackEvent.h"
 #include "Dataset.h"
+#include "Event.h"
 #include "EventArgs.h"
 #include "Exception.h"
 #include "Object.h"
@@ -28,21 +33,28 @@ namespace aprilui
 		EventReceiver()
 	{
 		this->name = name;
+		this->nameId = 0;
 		this->parent = NULL;
 		this->enabled = true;
 		this->awake = true;
 		this->zOrder = 0;
+		this->_getterTable = NULL;
+		this->_setterTable = NULL;
 	}
 
 	BaseObject::BaseObject(const BaseObject& other) :
 		EventReceiver(other)
 	{
 		this->name = other.name;
+		this->nameId = other.nameId;
 		this->tag = other.tag;
 		this->parent = NULL;
 		this->enabled = other.enabled;
 		this->awake = other.awake;
 		this->zOrder = other.zOrder;
+		this->_broadcastTypeIds = other._broadcastTypeIds;
+		this->_getterTable = NULL;
+		this->_setterTable = NULL;
 	}
 
 	BaseObject::~BaseObject()
@@ -99,6 +111,16 @@ namespace aprilui
 			return;
 		}
 		this->name = value;
+		this->nameId = 0;
+	}
+
+	int BaseObject::getNameId()
+	{
+		if (this->nameId == 0)
+		{
+			this->nameId = aprilui::internName(this->name);
+		}
+		return this->nameId;
 	}
 
 	hstr BaseObject::getFullName() const
@@ -106,12 +128,52 @@ namespace aprilui
 		return (this->dataset != NULL ? this->dataset->getName() + "." + this->name : this->name);
 	}
 
+	void BaseObject::subscribeBroadcast(chstr type)
+	{
+		int typeId = Event::getTypeId(type);
+		if (!this->_broadcastTypeIds.has(typeId))
+		{
+			this->_broadcastTypeIds += typeId;
+			if (this->dataset != NULL)
+			{
+				this->dataset->_addBroadcastSubscriber(typeId, this);
+			}
+		}
+	}
+
+	void BaseObject::unsubscribeBroadcast(chstr type)
+	{
+		int typeId = Event::findTypeId(type);
+		if (this->_broadcastTypeIds.has(typeId))
+		{
+			this->_broadcastTypeIds -= typeId;
+			if (this->dataset != NULL)
+			{
+				this->dataset->_removeBroadcastSubscriber(typeId, this);
+			}
+		}
+	}
+
+	bool BaseObject::isSubscribedToBroadcast(chstr type) const
+	{
+		return this->_broadcastTypeIds.has(Event::findTypeId(type));
+	}
+
+	int64_t BaseObject::getByteSize() const
+	{
+		return (int64_t)(sizeof(BaseObject) + this->name.size() + this->tag.size() +
+			(this->childrenObjects.size() + this->_childrenObjects.size()) * sizeof(Object*) +
+			(this->childrenAnimators.size() + this->_childrenAnimators.size()) * sizeof(Animator*));
+	}
+
 	void BaseObject::setEnabled(const bool& value)
 	{
 		if (this->enabled != value)
 		{
 			this->enabled = value;
-			this->notifyEvent(Event::EnabledChanged, NULL);
+			this->_requestUpdate();
+			this->_requestRedraw();
+			this->notifyEvent(Event::EnabledChangedId, NULL);
 		}
 	}
 
@@ -120,7 +182,8 @@ namespace aprilui
 		if (this->awake != value)
 		{
 			this->awake = value;
-			this->notifyEvent(Event::AwakeChanged, NULL);
+			this->_requestUpdate();
+			this->notifyEvent(Event::AwakeChangedId, NULL);
 		}
 	}
 
@@ -128,10 +191,22 @@ namespace aprilui
 	{
 		if (this->zOrder != zOrder)
 		{
-			this->zOrder = zOrder;
 			if (this->parent != NULL)
 			{
-				this->parent->_sortChildren();
+				Object* object = dynamic_cast<Object*>(this);
+				if (object != NULL)
+				{
+					this->parent->_moveChild(object, zOrder);
+				}
+				else
+				{
+					this->zOrder = zOrder;
+				}
+				this->_invalidateDrawList();
+			}
+			else
+			{
+				this->zOrder = zOrder;
 			}
 		}
 	}
@@ -165,22 +240,61 @@ namespace aprilui
 
 	harray<BaseObject*> BaseObject::getDescendants() const
 	{
-		harray<BaseObject*> result = this->getChildren();
+		harray<BaseObject*> result;
+		this->_appendDescendants(result);
+		return result;
+	}
+
+	void BaseObject::_appendDescendants(harray<BaseObject*>& result) const
+	{
 		foreachc (Object*, it, this->childrenObjects)
 		{
-			result += (*it)->getDescendants();
+			result += (*it);
+		}
+		foreachc (Animator*, it, this->childrenAnimators)
+		{
+			result += (*it);
+		}
+		foreachc (Object*, it, this->childrenObjects)
+		{
+			(*it)->_appendDescendants(result);
 		}
-		return result;
 	}
 
 	harray<Object*> BaseObject::getDescendantObjects() const
 	{
-		harray<Object*> result = this->childrenObjects;
+		harray<Object*> result;
+		this->_appendDescendantObjects(result);
+		return result;
+	}
+
+	void BaseObject::_appendDescendantObjects(harray<Object*>& result) const
+	{
+		result += this->childrenObjects;
 		foreachc (Object*, it, this->childrenObjects)
 		{
-			result += (*it)->getDescendantObjects();
+			(*it)->_appendDescendantObjects(result);
+		}
+	}
+
+	void BaseObject::visitDescendants(Visitor visitor, void* userData, bool postOrder) const
+	{
+		foreachc (Object*, it, this->childrenObjects)
+		{
+			if (postOrder)
+			{
+				(*it)->visitDescendants(visitor, userData, postOrder);
+				visitor((*it), userData);
+			}
+			else if (visitor((*it), userData))
+			{
+				(*it)->visitDescendants(visitor, userData, postOrder);
+			}
+		}
+		foreachc (Animator*, it, this->childrenAnimators)
+		{
+			visitor((*it), userData);
 		}
-		return result;
 	}
 
 	hstr BaseObject::getProperty(chstr name)
@@ -206,6 +320,8 @@ namespace aprilui
 		{
 			hstr newValue = value;
 			setter->execute(this, newValue);
+			// not every setter reports its changes to the dataset
+			this->_requestRedraw();
 			return true;
 		}
 		if (name != "type")
@@ -220,6 +336,147 @@ namespace aprilui
 		return this->getPropertyDescriptions().hasKey(name);
 	}
 
+	// conversions used when a property can only be accessed through strings
+	static inline hstr _propertyValueToString(const int& value) { return hstr(value); }
+	static inline hstr _propertyValueToString(const float& value) { return hstr(value); }
+	static inline hstr _propertyValueToString(const bool& value) { return hstr(value ? "true" : "false"); }
+	static inline hstr _propertyValueToString(cgvec2f value) { return april::gvec2ToHstr<float>(value); }
+	static inline hstr _propertyValueToString(const gvec3f& value) { return april::gvec3ToHstr<float>(value); }
+	static inline hstr _propertyValueToString(cgrectf value) { return april::grectToHstr<float>(value); }
+	static inline hstr _propertyValueToString(const april::Color& value) { return value.hex(); }
+	static inline void _propertyValueFromString(chstr string, int& value) { value = (int)string; }
+	static inline void _propertyValueFromString(chstr string, float& value) { value = (float)string; }
+	static inline void _propertyValueFromString(chstr string, bool& value) { value = (bool)string; }
+	static inline void _propertyValueFromString(chstr string, gvec2f& value) { value = april::hstrToGvec2<float>(string); }
+	static inline void _propertyValueFromString(chstr string, gvec3f& value) { value = april::hstrToGvec3<float>(string); }
+	static inline void _propertyValueFromString(chstr string, grectf& value) { value = april::hstrToGrect<float>(string); }
+	static inline void _propertyValueFromString(chstr string, april::Color& value) { value = aprilui::_makeColor(string); }
+
+	template <typename T>
+	bool BaseObject::_getPropertyValue(int propertyId, T& value, const PropertyDescription::Type& valueType)
+	{
+		if (this->_getterTable == NULL)
+		{
+			this->_getterTable = &PropertyDescription::getAccessorTable(this->_getGetters());
+		}
+		if (propertyId >= 0 && propertyId < this->_getterTable->size())
+		{
+			PropertyDescription::Accessor* getter = (*this->_getterTable)[propertyId];
+			if (getter != NULL && getter->executeTyped(this, &value, valueType))
+			{
+				return true;
+			}
+		}
+		hstr name = PropertyDescription::findNameById(propertyId);
+		if (name == "")
+		{
+			hlog::errorf(logTag, "Could not get property with ID %d in '%s'!", propertyId, this->name.cStr());
+			return false;
+		}
+		hstr result = this->getProperty(name);
+		if (result == "")
+		{
+			return false;
+		}
+		_propertyValueFromString(result, value);
+		return true;
+	}
+
+	template <typename T>
+	bool BaseObject::_setPropertyValue(int propertyId, const T& value, const PropertyDescription::Type& valueType)
+	{
+		if (this->_setterTable == NULL)
+		{
+			this->_setterTable = &PropertyDescription::getAccessorTable(this->_getSetters());
+		}
+		if (propertyId >= 0 && propertyId < this->_setterTable->size())
+		{
+			PropertyDescription::Accessor* setter = (*this->_setterTable)[propertyId];
+			if (setter != NULL && setter->executeTyped(this, (void*)&value, valueType))
+			{
+				this->_requestRedraw();
+				return true;
+			}
+		}
+		hstr name = PropertyDescription::findNameById(propertyId);
+		if (name == "")
+		{
+			hlog::errorf(logTag, "Could not set property with ID %d in '%s'!", propertyId, this->name.cStr());
+			return false;
+		}
+		return this->setProperty(name, _propertyValueToString(value));
+	}
+
+	bool BaseObject::getPropertyValue(int propertyId, int& value)
+	{
+		return this->_getPropertyValue(propertyId, value, PropertyDescription::Type::Int);
+	}
+
+	bool BaseObject::getPropertyValue(int propertyId, float& value)
+	{
+		return this->_getPropertyValue(propertyId, value, PropertyDescription::Type::Float);
+	}
+
+	bool BaseObject::getPropertyValue(int propertyId, bool& value)
+	{
+		return this->_getPropertyValue(propertyId, value, PropertyDescription::Type::Bool);
+	}
+
+	bool BaseObject::getPropertyValue(int propertyId, gvec2f& value)
+	{
+		return this->_getPropertyValue(propertyId, value, PropertyDescription::Type::Gvec2f);
+	}
+
+	bool BaseObject::getPropertyValue(int propertyId, gvec3f& value)
+	{
+		return this->_getPropertyValue(propertyId, value, PropertyDescription::Type::Gvec3f);
+	}
+
+	bool BaseObject::getPropertyValue(int propertyId, grectf& value)
+	{
+		return this->_getPropertyValue(propertyId, value, PropertyDescription::Type::Grectf);
+	}
+
+	bool BaseObject::getPropertyValue(int propertyId, april::Color& value)
+	{
+		return this->_getPropertyValue(propertyId, value, PropertyDescription::Type::Color);
+	}
+
+	bool BaseObject::setPropertyValue(int propertyId, const int& value)
+	{
+		return this->_setPropertyValue(propertyId, value, PropertyDescription::Type::Int);
+	}
+
+	bool BaseObject::setPropertyValue(int propertyId, const float& value)
+	{
+		return this->_setPropertyValue(propertyId, value, PropertyDescription::Type::Float);
+	}
+
+	bool BaseObject::setPropertyValue(int propertyId, const bool& value)
+	{
+		return this->_setPropertyValue(propertyId, value, PropertyDescription::Type::Bool);
+	}
+
+	bool BaseObject::setPropertyValue(int propertyId, cgvec2f value)
+	{
+		return this->_setPropertyValue(propertyId, value, PropertyDescription::Type::Gvec2f);
+	}
+
+	bool BaseObject::setPropertyValue(int propertyId, const gvec3f& value)
+	{
+		return this->_setPropertyValue(propertyId, value, PropertyDescription::Type::Gvec3f);
+	}
+
+	bool BaseObject::setPropertyValue(int propertyId, cgrectf value)
+	{
+		return this->_setPropertyValue(propertyId, value, PropertyDescription::Type::Grectf);
+	}
+
+	bool BaseObject::setPropertyValue(int propertyId, const april::Color& value)
+	{
+		return this->_setPropertyValue(propertyId, value, PropertyDescription::Type::Color);
+	}
+
 	void BaseObject::update(float timeDelta)
 	{
 		if (this->awake)
@@ -249,6 +506,100 @@ namespace aprilui
 		this->childrenObjects.sort(&_sortObjects::lambda);
 	}
 
+	void BaseObject::_insertChild(Object* object)
+	{
+		HL_LAMBDA_CLASS(_zOrderAfter, bool, ((const int& a, Object* const& b) { return (a < b->getZOrder()); }));
+		harray<Object*>::iterator it = std::upper_bound(this->childrenObjects.begin(), this->childrenObjects.end(), object->getZOrder(), &_zOrderAfter::lambda);
+		this->childrenObjects.insertAt((int)(it - this->childrenObjects.begin()), object);
+	}
+
+	void BaseObject::_mergeChildren(int sortedCount)
+	{
+		HL_LAMBDA_CLASS(_sortObjects, bool, ((Object* const& a, Object* const& b) { return (a->getZOrder() < b->getZOrder()); }));
+		harray<Object*>::iterator middle = this->childrenObjects.begin() + sortedCount;
+		std::stable_sort(middle, this->childrenObjects.end(), &_sortObjects::lambda);
+		std::inplace_merge(this->childrenObjects.begin(), middle, this->childrenObjects.end(), &_sortObjects::lambda);
+	}
+
+	void BaseObject::_moveChild(Object* object, int zOrder)
+	{
+		HL_LAMBDA_CLASS(_zOrderBefore, bool, ((Object* const& a, const int& b) { return (a->getZOrder() < b); }));
+		HL_LAMBDA_CLASS(_zOrderAfter, bool, ((const int& a, Object* const& b) { return (a < b->getZOrder()); }));
+		harray<Object*>::iterator begin = this->childrenObjects.begin();
+		harray<Object*>::iterator end = this->childrenObjects.end();
+		// only objects with the same Z order have to be searched to find the object
+		harray<Object*>::iterator it = std::lower_bound(begin, end, object->zOrder, &_zOrderBefore::lambda);
+		while (it != end && (*it) != object && (*it)->zOrder == object->zOrder)
+		{
+			++it;
+		}
+		int oldZOrder = object->zOrder;
+		object->zOrder = zOrder;
+		if (it == end || (*it) != object)
+		{
+			// children are not sorted properly at the moment (e.g. while being appended)
+			this->_sortChildren();
+			return;
+		}
+		// the object is placed where a stable sort would put it, before others with the same Z order when moving
+		// towards the end and after others with the same Z order when moving towards the beginning
+		if (zOrder > oldZOrder)
+		{
+			std::rotate(it, it + 1, std::lower_bound(it + 1, end, zOrder, &_zOrderBefore::lambda));
+		}
+		else
+		{
+			std::rotate(std::upper_bound(begin, it, zOrder, &_zOrderAfter::lambda), it, it + 1);
+		}
+	}
+
+	Dataset* BaseObject::_getTreeDataset() const
+	{
+		const BaseObject* object = this;
+		while (object->parent != NULL)
+		{
+			object = object->parent;
+		}
+		return object->dataset;
+	}
+
+	void BaseObject::_invalidateDrawList()
+	{
+		// the draw list containing this object is recorded by the dataset of the tree's root
+		Dataset* treeDataset = this->_getTreeDataset();
+		if (treeDataset != NULL)
+		{
+			treeDataset->invalidateDrawList();
+		}
+		if (this->dataset != NULL && this->dataset != treeDataset)
+		{
+			this->dataset->invalidateDrawList();
+		}
+	}
+
+	void BaseObject::_requestRedraw()
+	{
+		// animators change their parent, dynamic animators are not even registered in a dataset
+		if (this->parent != NULL)
+		{
+			((BaseObject*)this->parent)->_requestRedraw();
+		}
+		else if (this->dataset != NULL)
+		{
+			this->dataset->requestRedraw();
+		}
+	}
+
+	void BaseObject::_requestUpdate()
+	{
+		// objects attached to the tree of another dataset are updated by that dataset
+		Dataset* dataset = this->_getTreeDataset();
+		if (dataset != NULL)
+		{
+			dataset->requestUpdate();
+		}
+	}
+
 	bool BaseObject::isChild(BaseObject* object)
 	{
 		return (object != NULL && object->isParent(this));
@@ -318,14 +669,27 @@ namespace aprilui
 		return NULL;
 	}
 
+	BaseObject* BaseObject::findChildByNameId(int nameId)
+	{
+		// the name is resolved only once instead of interning the names of all children
+		hstr name = aprilui::getInternedName(nameId);
+		return (name != "" ? this->findChildByName(name) : NULL);
+	}
+
+	BaseObject* BaseObject::findDescendantByNameId(int nameId)
+	{
+		hstr name = aprilui::getInternedName(nameId);
+		return (name != "" ? this->findDescendantByName(name) : NULL);
+	}
+
 	void BaseObject::applyStyle(Style* style)
 	{
 		if (style != NULL)
 		{
-			hmap<hstr, hstr> properties = style->findProperties(this->getClassName());
-			foreach_m (hstr, it, properties)
+			const harray<Style::PropertyValue>& properties = style->findFlattenedProperties(this->getClassName());
+			foreachc (Style::PropertyValue, it, properties)
 			{
-				this->setProperty(it->first, it->second);
+				this->setProperty((*it).first, (*it).second);
 			}
 		}
 	}
@@ -6,7 +6,11 @@
 /// This program is free software; you can redistribute it and/or modify it under
 /// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
 
+#include <string.h>
+#include <algorithm>
+
 #include <april/april.h>
+#include <april/Image.h>
 #include <april/Platform.h>
 #include <april/RenderSystem.h>
 #include <april/Texture.h>
@@ -17,6 +21,7 @@
 #include <hltypes/hlog.h>
 #include <hltypes/hltypesUtil.h>
 #include <hltypes/hmap.h>
+#include <hltypes/hmutex.h>
 #include <hltypes/hrdir.h>
 #include <hltypes/hresource.h>
 #include <hltypes/hthread.h>
@@ -35,6 +40,12 @@
 #include "Style.h"
 #include "Texture.h"
 
+#define APRILUI_MAX_DIRTY_RECTS 8
+#define APRILUI_TEXTURE_ATLAS_PADDING 2
+#define APRILUI_MAX_COMPOSITE_TEXTS 1024
+#define APRILUI_MAX_COMPOSITE_TEXT_LITERALS 256
+#define APRILUI_COMPOSITE_TEXT_PLACEHOLDER_BASE 0xE000
+
 #define __EXPAND(...) __VA_ARGS__
 #define ASSERT_NO_ASYNC_LOADING(methodName, returnValue) \
 	if (this->_asyncPreLoading) \
@@ -48,9 +59,110 @@ namespace aprilui
 	static harray<hstr> _ignoredStandardProperties = hstr("name,rect,position,size,x,y,w,h").split(',');
 	static harray<hstr> _ignoredStyleProperties = _ignoredStandardProperties + "style";
 
+	// composite text keys can reference texts from other datasets so any change of texts invalidates all cached composite texts
+	static int _textsRevision = 0;
+	static hmutex _textsRevisionMutex; // texts are also loaded in the async loading thread and text loading threads
+
+	static void _increaseTextsRevision()
+	{
+		hmutex::ScopeLock lock(&_textsRevisionMutex);
+		++_textsRevision;
+	}
+
+	static int _getTextsRevision()
+	{
+		hmutex::ScopeLock lock(&_textsRevisionMutex);
+		return _textsRevision;
+	}
+
+	static hstr _makeCompositeTextPlaceholder(int index)
+	{
+		// characters from the private use area don't appear in regular texts
+		unsigned int chars[2] = {APRILUI_COMPOSITE_TEXT_PLACEHOLDER_BASE + (unsigned int)index, 0};
+		return hstr::fromUnicode(chars);
+	}
+
+	// replaces the literal arguments of a composite text key with placeholders so all keys with the same structure share one template
+	static bool _makeCompositeTextTemplateKey(chstr key, int argsStart, hstr& templateKey, harray<hstr>& literals)
+	{
+		templateKey = key(0, argsStart);
+		literals.clear();
+		int start = argsStart;
+		int openIndex = key.indexOf('{', start);
+		int closeIndex = 0;
+		hstr literal;
+		while (openIndex >= 0)
+		{
+			closeIndex = key.indexOf('}', openIndex);
+			if (closeIndex < 0 || key(start, openIndex - start).contains("}") || literals.size() >= APRILUI_MAX_COMPOSITE_TEXT_LITERALS)
+			{
+				return false;
+			}
+			literal = key(openIndex + 1, closeIndex - openIndex - 1);
+			// a literal can be used as format of another argument which changes the structure of the key
+			if (literal.contains("%"))
+			{
+				return false;
+			}
+			templateKey += key(start, openIndex + 1 - start) + _makeCompositeTextPlaceholder(literals.size()) + "}";
+			literals += literal;
+			start = closeIndex + 1;
+			openIndex = key.indexOf('{', start);
+		}
+		if (key.indexOf('}', start) >= 0)
+		{
+			return false;
+		}
+		templateKey += key(start, -1);
+		return true;
+	}
+
 	void _registerDataset(chstr name, Dataset* dataset);
 	void _unregisterDataset(chstr name, Dataset* dataset);
+	Dataset* _getDatasetByNameId(int nameId);
+	bool _getInternedNameParts(int nameId, int& datasetNameId, int& localNameId);
 	
+	Dataset* Dataset::_drawListRecorder = NULL;
+	bool Dataset::_drawBoundsRecording = false;
+	const grectf* Dataset::_drawDirtyRect = NULL;
+
+	static bool _isIdentityMatrix(const gmat4& matrix)
+	{
+		for_iter (i, 0, 16)
+		{
+			if (matrix.data[i] != (i % 5 == 0 ? 1.0f : 0.0f))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	static grectf _makeUnion(cgrectf a, cgrectf b)
+	{
+		gvec2f min(hmin(a.x, b.x), hmin(a.y, b.y));
+		gvec2f max(hmax(a.x + a.w, b.x + b.w), hmax(a.y + a.h, b.y + b.h));
+		return grectf(min, max - min);
+	}
+
+	Dataset::DrawListEntry::DrawListEntry()
+	{
+		this->object = NULL;
+		this->clipChanged = false;
+	}
+
+	Dataset::InstanceNode::InstanceNode(BaseObject* prototype, int parentIndex)
+	{
+		this->prototype = prototype;
+		this->parentIndex = parentIndex;
+	}
+
+	Dataset::TextureIdleDeadline::TextureIdleDeadline(double time, Texture* texture)
+	{
+		this->time = time;
+		this->texture = texture;
+	}
+
 	Dataset::Dataset(chstr filename, chstr name, bool useNameBasePath) :
 		EventReceiver()
 	{
@@ -66,9 +178,23 @@ namespace aprilui
 		}
 		this->textsPaths += aprilui::getDefaultTextsPath();
 		this->loaded = false;
+		this->retainedDrawing = false;
+		this->redrawNeeded = true;
+		this->updateNeeded = true;
+		this->dirtyRectRedrawing = false;
+		this->subscribedBroadcasting = false;
+		this->pointerRouting = false;
 		this->_asyncPreLoading = false;
 		this->_asyncPreLoadThread = NULL;
 		this->_internalLoadDataset = NULL;
+		this->_compositeTextsRevision = _getTextsRevision();
+		this->_textsByNameIdRevision = this->_compositeTextsRevision;
+		this->_drawListValid = false;
+		this->_drawListRoot = NULL;
+		this->_drawListDebug = false;
+		this->_fullRedrawNeeded = true;
+		this->_textureTime = 0.0;
+		this->_textureIdleUnloadTime = 0.0f;
 		aprilui::_registerDataset(this->name, this);
 	}
 	
@@ -96,6 +222,15 @@ namespace aprilui
 		this->textsPaths += value;
 	}
 
+	void Dataset::setPointerRouting(bool value)
+	{
+		if (this->pointerRouting != value)
+		{
+			this->pointerRouting = value;
+			this->pointerObjects.clear();
+		}
+	}
+
 	bool Dataset::isLoaded()
 	{
 		if (this->loaded)
@@ -247,38 +382,64 @@ namespace aprilui
 			}
 			__THROW_EXCEPTION(ObjectNotExistsException("Object", root->getName(), this->name), aprilui::objectExistenceDebugExceptionsEnabled, return);
 		}
-		harray<BaseObject*> children = root->getChildren();
-		foreach (BaseObject*, it, children)
-		{
-			this->destroyObjects(*it);
-		}
+		// the root is detached first, since detaching still walks the subtree
 		aprilui::Object* rootParent = root->getParent();
 		if (rootParent != NULL)
 		{
 			rootParent->removeChild(root);
 		}
-		Object* object = dynamic_cast<Object*>(root);
-		if (object != NULL)
+		// descendants are destroyed in post-order without detaching them one by one since their parents are destroyed as well
+		root->visitDescendants(&Dataset::_visitDestroyObject, this, true);
+		this->_destroyObject(root);
+	}
+
+	void Dataset::_destroyObject(BaseObject* object)
+	{
+		Object* focusedObject = dynamic_cast<Object*>(object);
+		if (focusedObject != NULL)
 		{
-			if (object->isFocused())
+			if (focusedObject->isFocused())
 			{
-				object->setFocused(false);
+				focusedObject->setFocused(false);
 			}
-			this->objects.removeKey(root->getName());
-		}
-		else
-		{
-			Animator* animator = dynamic_cast<Animator*>(root);
-			if (animator != NULL)
+			this->objects.removeKey(object->getName());
+			if (object->nameId != 0)
 			{
-				this->animators.removeKey(root->getName());
+				this->objectsByNameId.removeKey(object->nameId);
 			}
+			this->_releaseTouches(focusedObject);
+			this->pointerObjects.removeAll(focusedObject);
+		}
+		else if (dynamic_cast<Animator*>(object) != NULL)
+		{
+			this->animators.removeKey(object->getName());
 		}
-		if (this->root == root)
+		this->_unsubscribeBroadcasts(object);
+		if (this->root == object)
 		{
 			this->root = NULL;
 		}
-		delete root;
+		// children were already destroyed in post-order, so nothing may reach them through this object anymore
+		object->childrenObjects.clear();
+		object->childrenAnimators.clear();
+		delete object;
+	}
+
+	bool Dataset::_visitDestroyObject(BaseObject* object, void* userData)
+	{
+		Dataset* dataset = (Dataset*)userData;
+		if (!dataset->objects.hasKey(object->getName()) && !dataset->animators.hasKey(object->getName()))
+		{
+			// this object could be from another dataset, so check that first.
+			if (object->dataset == NULL || object->dataset == dataset)
+			{
+				__THROW_EXCEPTION(ObjectNotExistsException("Object", object->getName(), dataset->name), aprilui::objectExistenceDebugExceptionsEnabled, return true);
+			}
+			hlog::warnf(logTag, "Dataset '%s' destroying object from another dataset: '%s'", dataset->getName().cStr(), object->getFullName().cStr());
+			dataset = object->dataset;
+		}
+		dataset->_destroyObject(object);
+		return true;
 	}
 	
 	void Dataset::_destroyTexture(chstr name)
@@ -287,6 +448,8 @@ namespace aprilui
 		{
 			__THROW_EXCEPTION(ObjectNotExistsException("Texture", name, this->name), aprilui::objectExistenceDebugExceptionsEnabled, return);
 		}
+		this->_removeAtlasTexture(this->textures[name]);
+		this->prefetchQueue.removeAll(this->textures[name]);
 		delete this->textures[name];
 		this->textures.removeKey(name);
 	}
@@ -297,8 +460,10 @@ namespace aprilui
 		{
 			__THROW_EXCEPTION(ObjectNotExistsException("Image", name, this->name), aprilui::objectExistenceDebugExceptionsEnabled, return);
 		}
+		this->_removeAtlasImage(this->images[name]);
 		delete this->images[name];
 		this->images.removeKey(name);
+		this->imagesByNameId.clear();
 	}
 
 	void Dataset::_destroyStyle(chstr name)
@@ -309,6 +474,7 @@ namespace aprilui
 		}
 		delete this->styles[name];
 		this->styles.removeKey(name);
+		this->stylesByNameId.clear();
 	}
 
 	void Dataset::_destroyTexture(Texture* texture)
@@ -318,7 +484,9 @@ namespace aprilui
 		{
 			__THROW_EXCEPTION(ObjectNotExistsException("Texture", filename, this->name), aprilui::objectExistenceDebugExceptionsEnabled, return);
 		}
+		this->_removeAtlasTexture(texture);
 		this->textures.removeKey(filename);
+		this->prefetchQueue.removeAll(texture);
 		delete texture;
 	}
 	
@@ -329,7 +497,9 @@ namespace aprilui
 		{
 			__THROW_EXCEPTION(ObjectNotExistsException("Image", name, this->name), aprilui::objectExistenceDebugExceptionsEnabled, return);
 		}
+		this->_removeAtlasImage(image);
 		this->images.removeKey(name);
+		this->imagesByNameId.clear();
 		delete image;
 	}
 
@@ -341,6 +511,7 @@ namespace aprilui
 			__THROW_EXCEPTION(ObjectNotExistsException("Style", name, this->name), aprilui::objectExistenceDebugExceptionsEnabled, return);
 		}
 		this->styles.removeKey(name);
+		this->stylesByNameId.clear();
 		delete style;
 	}
 
@@ -646,6 +817,7 @@ namespace aprilui
 				break;
 			}
 		}
+		style->_invalidateCache();
 	}
 
 	BaseObject* Dataset::parseObject(hlxml::Node* node, Object* parent)
@@ -657,6 +829,7 @@ namespace aprilui
 	void Dataset::_parseTextureGroup(hlxml::Node* node)
 	{
 		harray<hstr> names = node->pstr("names").split(",", -1, true);
+		this->textureGroups += names;
 		foreach (hstr, it, names)
 		{
 			if ((*it).startsWith(" "))
@@ -804,10 +977,11 @@ namespace aprilui
 			object->setRect(rect);
 		}
 		baseObject->dataset = this;
+		this->_subscribeBroadcasts(baseObject);
 		EventArgs args(Event::RegisteredInDataset, this);
-		baseObject->notifyEvent(Event::RegisteredInDataset, &args);
-		bool isCustomStyle = node->pexists("style");
-		if (isCustomStyle)
+		baseObject->notifyEvent(Event::RegisteredInDatasetId, &args);
+		bool isEmptyStyle = false;
+		if (node->pexists("style"))
 		{
 			hstr styleName = node->pstr("style");
 			if (styleName != "")
@@ -818,23 +992,23 @@ namespace aprilui
 					newStyle = this->getStyle(styleName);
 					if (newStyle != NULL)
 					{
-						style = style->_injected(newStyle);
+						// cached in the parent style so siblings using the same style don't have to merge it again
+						style = style->_findInjected(newStyle);
 					}
 					else
 					{
 						hlog::error(logTag, "Cannot find Style '" + styleName + "'!");
-						isCustomStyle = false;
 					}
 				}
 				catch (hexception& e)
 				{
 					hlog::error(logTag, "Cannot find Style '" + styleName + "':" + e.getMessage());
-					isCustomStyle = false;
 				}
 			}
 			else
 			{
 				style = new Style();
+				isEmptyStyle = true;
 			}
 		}
 		baseObject->applyStyle(style);
@@ -886,7 +1060,7 @@ namespace aprilui
 				}
 			}
 		}
-		if (isCustomStyle)
+		if (isEmptyStyle)
 		{
 			delete style;
 		}
@@ -1314,9 +1488,13 @@ namespace aprilui
 		{
 			this->_load();
 		}
+		if (aprilui::getTextureAtlasPageSize() > 0)
+		{
+			this->_buildTextureAtlases();
+		}
 		this->loaded = true;
 		this->update(0.0f);
-		this->triggerEvent(aprilui::Event::DatasetLoaded);
+		this->triggerEvent(aprilui::Event::DatasetLoadedId);
 	}
 
 	void Dataset::_asyncLoad(hthread* thread)
@@ -1363,253 +1541,818 @@ namespace aprilui
 		}
 	}
 
-	hstr Dataset::_makeTextsPath(chstr textsPath)
+	void Dataset::_buildTextureAtlases()
 	{
-		hstr filepathPrefix = hrdir::joinPath(this->filePath, textsPath, false);
-		hstr filepath = hrdir::normalize(hrdir::joinPath(filepathPrefix, aprilui::getLocalization(), false));
-		if (!hrdir::exists(filepath))
+		int pageSize = aprilui::getTextureAtlasPageSize();
+		int maxSize = hmin(aprilui::getTextureAtlasMaxTextureSize(), pageSize - APRILUI_TEXTURE_ATLAS_PADDING * 2);
+		// tile images rely on the texture's own address mode so their textures have to stay separate
+		harray<Texture*> excluded;
+		TileImage* tileImage = NULL;
+		foreach_m (BaseImage*, it, this->images)
 		{
-			filepath = hrdir::normalize(hrdir::joinPath(filepathPrefix, aprilui::getDefaultLocalization(), false));
+			tileImage = dynamic_cast<TileImage*>(it->second);
+			if (tileImage != NULL && tileImage->getTexture() != NULL)
+			{
+				excluded += tileImage->getTexture();
+			}
 		}
-		return filepath;
-	}
-	
-	void Dataset::_loadTexts(chstr path)
-	{
-		harray<hstr> files = hrdir::files(path, true);
-		if (files.size() > 0)
+		harray<Texture*> candidates;
+		Texture* texture = NULL;
+		foreach_m (Texture*, it, this->textures)
 		{
-			hlog::write(logTag, "Loading texts: " + path);
-			hresource file;
-			hstream data;
-			foreach (hstr, it, files)
+			texture = it->second;
+			if (texture->addressMode == april::Texture::AddressMode::Clamp && texture->scale.x == 1.0f && texture->scale.y == 1.0f &&
+				!excluded.has(texture) && texture->loadMetaData() && texture->getWidth() <= maxSize && texture->getHeight() <= maxSize)
 			{
-				file.open(*it);
-				data.writeRaw(file);
-				data.rewind();
-				file.close();
-				if (data.size() > 0)
-				{
-					this->_loadTextResource(data, this->texts);
-					data.clear();
-				}
-				// preload was aborted
-				if (this->_asyncPreLoadThread != NULL && !this->_asyncPreLoading)
-				{
-					break;
-				}
+				candidates += texture;
 			}
 		}
-	}
-	
-	void Dataset::_loadTextResource(hstream& data, hmap<hstr, hstr>& textsMap)
-	{
-		harray<hstr> values;
-		bool keyMode = true;
-		hstr key;
-		harray<hstr> lines = data.readLines();
-		// UTF-8 might have a Byte Order Marker
-		hstr firstLine = lines.first();
-		if (firstLine.size() > 0)
+		// textures in the same texture group are used together so they are packed together
+		harray<harray<Texture*> > groups;
+		harray<Texture*> group;
+		foreach (harray<hstr>, it, this->textureGroups)
 		{
-			int i = 0;
-			while (i < firstLine.size() && !hbetweenII((int)firstLine[i], 0, 127))
+			group.clear();
+			foreach (hstr, it2, (*it))
 			{
-				++i;
+				texture = this->textures.tryGet((*it2), NULL);
+				if (texture != NULL && candidates.has(texture))
+				{
+					group += texture;
+					candidates -= texture;
+				}
+			}
+			if (group.size() > 1)
+			{
+				groups += group;
 			}
-			lines[0] = (i < firstLine.size() ? firstLine(i, firstLine.size() - i) : "");
 		}
-		keyMode = true;
-		values.clear();
-		// now parse the entries
-		foreach (hstr, it2, lines)
+		if (candidates.size() > 1)
 		{
-			if (keyMode)
+			groups += candidates;
+		}
+		int pageIndex = 0;
+		foreach (harray<Texture*>, it, groups)
+		{
+			pageIndex = this->_buildTextureAtlas((*it), pageIndex);
+		}
+	}
+
+	int Dataset::_buildTextureAtlas(harray<Texture*> textures, int pageIndex)
+	{
+		int pageSize = aprilui::getTextureAtlasPageSize();
+		HL_LAMBDA_CLASS(_sortTextures, bool, ((Texture* const& a, Texture* const& b) { return (a->getHeight() > b->getHeight()); }));
+		textures.sort(&_sortTextures::lambda);
+		hmap<Texture*, gvec2i> positions;
+		harray<Texture*> pageTextures;
+		gvec2i position(APRILUI_TEXTURE_ATLAS_PADDING, APRILUI_TEXTURE_ATLAS_PADDING);
+		int shelfHeight = 0;
+		int usedHeight = 0;
+		int width = 0;
+		int height = 0;
+		april::Image* page = NULL;
+		april::Image* image = NULL;
+		april::Texture* aprilTexture = NULL;
+		Texture* atlas = NULL;
+		MinimalImage* minimalImage = NULL;
+		grectf srcRect;
+		hstr atlasName;
+		while (textures.size() > 0)
+		{
+			// simple shelf packing, textures are sorted by height so each shelf is as high as its first texture
+			positions.clear();
+			pageTextures.clear();
+			position.set(APRILUI_TEXTURE_ATLAS_PADDING, APRILUI_TEXTURE_ATLAS_PADDING);
+			shelfHeight = 0;
+			usedHeight = 0;
+			for_iter (i, 0, textures.size())
 			{
-				if ((*it2) == "{")
+				width = textures[i]->getWidth();
+				height = textures[i]->getHeight();
+				if (position.x + width + APRILUI_TEXTURE_ATLAS_PADDING > pageSize)
 				{
-					values.clear();
-					keyMode = false;
+					position.set(APRILUI_TEXTURE_ATLAS_PADDING, position.y + shelfHeight + APRILUI_TEXTURE_ATLAS_PADDING);
+					shelfHeight = 0;
 				}
-				else
+				if (position.y + height + APRILUI_TEXTURE_ATLAS_PADDING > pageSize)
 				{
-					key = (*it2).split("#").first().trimmed(' ');
+					continue;
 				}
+				positions[textures[i]] = position;
+				pageTextures += textures[i];
+				position.x += width + APRILUI_TEXTURE_ATLAS_PADDING;
+				shelfHeight = hmax(shelfHeight, height);
+				usedHeight = hmax(usedHeight, position.y + height + APRILUI_TEXTURE_ATLAS_PADDING);
 			}
-			else if ((*it2) == "}")
+			textures -= pageTextures;
+			if (pageTextures.size() < 2)
 			{
-				keyMode = true;
-				if (key != "")
+				continue;
+			}
+			height = 1;
+			while (height < usedHeight)
+			{
+				height *= 2;
+			}
+			height = hmin(height, pageSize);
+			page = april::Image::create(pageSize, height, april::Color::Clear, april::Image::Format::RGBA);
+			foreach (Texture*, it, pageTextures)
+			{
+				image = april::Image::createFromResource((*it)->getTexture()->getFilename());
+				if (image == NULL)
 				{
-					textsMap[key] = values.joined('\n');
+					hlog::warnf(logTag, "Could not read texture '%s' for atlas packing, skipping.", (*it)->getName().cStr());
+					positions.removeKey(*it);
+					continue;
 				}
+				position = positions[*it];
+				page->write(0, 0, image->w, image->h, position.x, position.y, image);
+				// edge pixels are extruded into the padding so filtering at the borders doesn't bleed in neighbouring textures
+				for_iter (i, 1, APRILUI_TEXTURE_ATLAS_PADDING / 2 + 1)
+				{
+					page->write(0, 0, 1, image->h, position.x - i, position.y, image);
+					page->write(image->w - 1, 0, 1, image->h, position.x + image->w - 1 + i, position.y, image);
+					page->write(0, 0, image->w, 1, position.x, position.y - i, image);
+					page->write(0, image->h - 1, image->w, 1, position.x, position.y + image->h - 1 + i, image);
+					for_iter (j, 1, APRILUI_TEXTURE_ATLAS_PADDING / 2 + 1)
+					{
+						page->write(0, 0, 1, 1, position.x - i, position.y - j, image);
+						page->write(image->w - 1, 0, 1, 1, position.x + image->w - 1 + i, position.y - j, image);
+						page->write(0, image->h - 1, 1, 1, position.x - i, position.y + image->h - 1 + j, image);
+						page->write(image->w - 1, image->h - 1, 1, 1, position.x + image->w - 1 + i, position.y + image->h - 1 + j, image);
+					}
+				}
+				delete image;
 			}
-			else
+			aprilTexture = april::rendersys->createTexture(page->w, page->h, page->data, page->format);
+			delete page;
+			if (aprilTexture == NULL)
 			{
-				values += (*it2);
+				hlog::errorf(logTag, "Could not create texture atlas page %d in dataset '%s'!", pageIndex, this->name.cStr());
+				continue;
 			}
-			// preload was aborted
-			if (this->_asyncPreLoadThread != NULL && !this->_asyncPreLoading)
+			// the reserved prefix keeps atlas pages apart from user textures, but a clashing name is still skipped
+			do
 			{
-				break;
+				atlasName = hsprintf("__atlas_%d", pageIndex);
+				++pageIndex;
+			} while (this->textures.hasKey(atlasName));
+			atlas = new Texture(atlasName, atlasName, aprilTexture, false);
+			atlas->dataset = this;
+			this->textures[atlasName] = atlas;
+			this->_atlasTextures += atlas;
+			foreach_m (BaseImage*, it, this->images)
+			{
+				minimalImage = dynamic_cast<MinimalImage*>(it->second);
+				if (minimalImage != NULL && positions.hasKey(minimalImage->getTexture()))
+				{
+					position = positions[minimalImage->getTexture()];
+					srcRect = minimalImage->getSrcRect();
+					srcRect.x += (float)position.x;
+					srcRect.y += (float)position.y;
+					this->_atlasImageTextures[minimalImage] = minimalImage->getTexture();
+					this->_atlasImageSrcRects[minimalImage] = minimalImage->getSrcRect();
+					minimalImage->setTexture(atlas);
+					minimalImage->setSrcRect(srcRect);
+				}
+			}
+			// the original textures are not needed anymore, but they stay registered so they can still be referenced by name
+			for (hmap<Texture*, gvec2i>::iterator it = positions.begin(); it != positions.end(); ++it)
+			{
+				foreach (Texture*, it2, it->first->links)
+				{
+					(*it2)->removeLink(it->first);
+				}
+				it->first->links.clear();
+				it->first->unload();
 			}
+			hlog::writef(logTag, "Packed %d textures into atlas page '%s' (%dx%d) in dataset '%s'.", positions.size(), atlasName.cStr(), aprilTexture->getWidth(), aprilTexture->getHeight(), this->name.cStr());
 		}
+		return pageIndex;
 	}
 
-	void Dataset::unload()
+	void Dataset::_destroyTextureAtlases()
 	{
-		if (this->_asyncPreLoadThread != NULL && this->_asyncPreLoading)
+		for (hmap<MinimalImage*, Texture*>::iterator it = this->_atlasImageTextures.begin(); it != this->_atlasImageTextures.end(); ++it)
 		{
-			// abort pre-load
-			this->_asyncPreLoading = false;
-			this->_asyncPreLoadThread->join();
-			delete this->_asyncPreLoadThread;
-			this->_asyncPreLoadThread = NULL;
-			// make sure to delete everything below
-			this->loaded = true;
+			it->first->setTexture(it->second);
+			it->first->setSrcRect(this->_atlasImageSrcRects[it->first]);
 		}
-		else if (!this->isLoaded())
+		this->_atlasImageTextures.clear();
+		this->_atlasImageSrcRects.clear();
+		foreach (Texture*, it, this->_atlasTextures)
 		{
-			return;
+			this->textures.removeKey((*it)->getName());
+			delete (*it);
 		}
-		this->_unload();
+		this->_atlasTextures.clear();
+		this->invalidateDrawList();
 	}
-	
-	void Dataset::_unload()
+
+	void Dataset::_removeAtlasImage(BaseImage* image)
 	{
-		this->_closeDocuments();
-		aprilui::Object* parent = NULL;
-		foreach_m (Animator*, it, this->animators)
+		MinimalImage* minimalImage = dynamic_cast<MinimalImage*>(image);
+		if (minimalImage != NULL && this->_atlasImageTextures.hasKey(minimalImage))
 		{
-			parent = it->second->getParent();
-			if (parent != NULL)
-			{
-				parent->removeChild(it->second);
-			}
-			delete it->second;
+			minimalImage->setTexture(this->_atlasImageTextures[minimalImage]);
+			minimalImage->setSrcRect(this->_atlasImageSrcRects[minimalImage]);
+			this->_atlasImageTextures.removeKey(minimalImage);
+			this->_atlasImageSrcRects.removeKey(minimalImage);
+			this->invalidateDrawList();
 		}
-		this->animators.clear();
-		foreach_m (Object*, it, this->objects)
+	}
+
+	void Dataset::_removeAtlasTexture(Texture* texture)
+	{
+		if (this->_atlasImageTextures.size() == 0)
 		{
-			parent = it->second->getParent();
-			if (parent != NULL)
+			return;
+		}
+		bool atlas = this->_atlasTextures.has(texture);
+		harray<MinimalImage*> images;
+		for (hmap<MinimalImage*, Texture*>::iterator it = this->_atlasImageTextures.begin(); it != this->_atlasImageTextures.end(); ++it)
+		{
+			if (it->second == texture || (atlas && it->first->getTexture() == texture))
 			{
-				parent->removeChild(it->second);
+				images += it->first;
 			}
-			it->second->removeChildren(false);
-			delete it->second;
 		}
-		this->objects.clear();
-		foreach_m (BaseImage*, it, this->images)
+		foreach (MinimalImage*, it, images)
 		{
-			delete it->second;
+			this->_removeAtlasImage(*it);
 		}
-		this->images.clear();
-		foreach_m (Texture*, it, this->textures)
+		if (atlas)
 		{
-			delete it->second;
+			this->_atlasTextures -= texture;
 		}
-		this->textures.clear();
-		foreach_m (Style*, it, this->styles)
+	}
+
+	hstr Dataset::_makeTextsPath(chstr textsPath)
+	{
+		hstr filepathPrefix = hrdir::joinPath(this->filePath, textsPath, false);
+		hstr filepath = hrdir::normalize(hrdir::joinPath(filepathPrefix, aprilui::getLocalization(), false));
+		if (!hrdir::exists(filepath))
 		{
-			delete it->second;
+			filepath = hrdir::normalize(hrdir::joinPath(filepathPrefix, aprilui::getDefaultLocalization(), false));
 		}
-		this->styles.clear();
-		this->callbacks.clear();
-		this->texts.clear();
-		this->root = NULL;
-		this->focusedObject = NULL;
-		this->loaded = false;
-		this->triggerEvent(aprilui::Event::DatasetUnloaded);
+		return filepath;
 	}
 	
-	void Dataset::registerObjects(BaseObject* root, bool setRootIfNull)
+	Dataset::TextsLoadThread::TextsLoadThread() :
+		hthread(&Dataset::_asyncTextsLoad, "aprilui async texts")
 	{
-		hstr name;
-		harray<BaseObject*> objects;
-		objects += root;
-		objects += root->getDescendants();
-		Object* object = NULL;
-		Animator* animator = NULL;
-		EventArgs args(Event::RegisteredInDataset, this);
-		foreach (BaseObject*, it, objects)
+		this->dataset = NULL;
+	}
+
+	void Dataset::_asyncTextsLoad(hthread* thread)
+	{
+		TextsLoadThread* loadThread = (TextsLoadThread*)thread;
+		foreach (hstr, it, loadThread->filenames)
 		{
-			name = (*it)->getName();
-			if (this->objects.hasKey(name) || this->animators.hasKey(name))
+			loadThread->texts += hmap<hstr, hstr>();
+			try
 			{
-				// this exception cannot be disabled on purpose
-				throw ObjectExistsException("Object", name, this->name);
+				loadThread->dataset->_loadTextFile((*it), loadThread->texts.last());
 			}
-			object = dynamic_cast<Object*>(*it);
-			if (object != NULL)
+			catch (hexception& e)
 			{
-				this->objects[name] = object;
+				// the error is raised again on the calling thread in the order of the files
+				loadThread->errorMessages[(*it)] = e.getMessage();
 			}
-			else
+			// preload was aborted
+			if (loadThread->dataset->_asyncPreLoadThread != NULL && !loadThread->dataset->_asyncPreLoading)
+			{
+				break;
+			}
+		}
+	}
+
+	void Dataset::_loadTexts(chstr path)
+	{
+		harray<hstr> files = hrdir::files(path, true);
+		if (files.size() == 0)
+		{
+			return;
+		}
+		hlog::write(logTag, "Loading texts: " + path);
+		_increaseTextsRevision();
+		int threadCount = hmin(files.size(), april::getSystemInfo().cpuCores);
+		// use more threads only if loading this synchronously
+		if (threadCount <= 1 || this->_asyncPreLoadThread != NULL)
+		{
+			foreach (hstr, it, files)
 			{
-				animator = dynamic_cast<Animator*>(*it);
-				if (animator != NULL)
+				this->_loadTextFile((*it), this->texts);
+				// preload was aborted
+				if (this->_asyncPreLoadThread != NULL && !this->_asyncPreLoading)
 				{
-					this->animators[name] = animator;
+					break;
 				}
 			}
-			(*it)->dataset = this;
-			(*it)->notifyEvent(Event::RegisteredInDataset, &args);
+			return;
 		}
-		// if no root objects exists, this root becomes the new root object
-		if (this->root == NULL && setRootIfNull)
+		// files are distributed round-robin and every file gets its own map so they can be merged in the original order
+		harray<TextsLoadThread*> threads;
+		TextsLoadThread* thread = NULL;
+		for_iter (i, 0, threadCount)
 		{
-			Object* rootObject = dynamic_cast<Object*>(root);
-			if (rootObject != NULL)
+			thread = new TextsLoadThread();
+			thread->dataset = this;
+			for (int j = i; j < files.size(); j += threadCount)
 			{
-				this->root = rootObject;
+				thread->filenames += files[j];
 			}
+			threads += thread;
+			thread->start();
 		}
-	}
-	
-	void Dataset::unregisterObjects(BaseObject* root)
-	{
-		if (root == NULL)
+		foreach (TextsLoadThread*, it, threads)
 		{
-			// this exception cannot be disabled on purpose
-			throw ObjectNotExistsException("Object", "NULL", this->name);
+			(*it)->join();
 		}
-		bool hasObject = this->objects.hasKey(root->getName());
-		bool hasAnimator = this->animators.hasKey(root->getName());
-		if (!hasObject && !hasAnimator)
+		hstr errorMessage;
+		bool failed = false;
+		for_iter (i, 0, files.size())
 		{
-			// this object could be from another dataset, so check that first.
-			Dataset* dataset = root->getDataset();
-			if (dataset != this)
+			thread = threads[i % threadCount];
+			if (i / threadCount < thread->texts.size())
 			{
-				hlog::writef(logTag, "Dataset '%s' unregistering object from another dataset: '%s'", this->getName().cStr(), root->getFullName().cStr());
-				dataset->unregisterObjects(root);
-				return;
+				if (thread->errorMessages.hasKey(files[i]))
+				{
+					errorMessage = thread->errorMessages[files[i]];
+					failed = true;
+					break;
+				}
+				this->texts.inject(thread->texts[i / threadCount]);
+			}
+		}
+		foreach (TextsLoadThread*, it, threads)
+		{
+			delete (*it);
+		}
+		if (failed)
+		{
+			throw Exception(errorMessage);
+		}
+	}
+
+	void Dataset::_loadTextFile(chstr filename, hmap<hstr, hstr>& textsMap)
+	{
+		hresource file;
+		file.open(filename);
+		int size = (int)file.size();
+		if (size > 0)
+		{
+			harray<char> data;
+			data.resize(size);
+			size = file.readRaw(&data[0], size);
+			file.close();
+			this->_loadTextResource(&data[0], size, textsMap);
+		}
+	}
+
+	void Dataset::_loadTextResource(hstream& data, hmap<hstr, hstr>& textsMap)
+	{
+		int size = (int)(data.size() - data.position());
+		if (size > 0)
+		{
+			harray<char> raw;
+			raw.resize(size);
+			size = data.readRaw(&raw[0], size);
+			this->_loadTextResource(&raw[0], size, textsMap);
+		}
+	}
+
+	void Dataset::_loadTextResource(const char* data, int size, hmap<hstr, hstr>& textsMap)
+	{
+		int position = 0;
+		// UTF-8 might have a Byte Order Marker
+		while (position < size && (unsigned char)data[position] > 127)
+		{
+			++position;
+		}
+		bool keyMode = true;
+		hstr key;
+		const char* line = NULL;
+		const char* lineEnd = NULL;
+		const char* keyEnd = NULL;
+		int lineSize = 0;
+		int valueStart = -1;
+		int valueEnd = -1;
+		bool valueCarriageReturn = false;
+		hstr value;
+		while (position < size)
+		{
+			line = data + position;
+			lineEnd = (const char*)memchr(line, '\n', size - position);
+			if (lineEnd == NULL)
+			{
+				lineEnd = data + size;
+			}
+			position = (int)(lineEnd - data) + 1;
+			if (lineEnd > line && lineEnd[-1] == '\r')
+			{
+				--lineEnd;
+			}
+			lineSize = (int)(lineEnd - line);
+			if (keyMode)
+			{
+				if (lineSize == 1 && line[0] == '{')
+				{
+					valueStart = -1;
+					valueEnd = -1;
+					valueCarriageReturn = false;
+					keyMode = false;
+				}
+				else
+				{
+					keyEnd = (const char*)memchr(line, '#', lineSize);
+					if (keyEnd == NULL)
+					{
+						keyEnd = lineEnd;
+					}
+					while (line < keyEnd && line[0] == ' ')
+					{
+						++line;
+					}
+					while (keyEnd > line && keyEnd[-1] == ' ')
+					{
+						--keyEnd;
+					}
+					key = hstr(line, (int)(keyEnd - line));
+				}
+			}
+			else if (lineSize == 1 && line[0] == '}')
+			{
+				keyMode = true;
+				if (key != "")
+				{
+					if (!valueCarriageReturn || valueStart < 0)
+					{
+						// value lines are contiguous in the buffer so they can be copied at once
+						value = (valueStart >= 0 ? hstr(data + valueStart, valueEnd - valueStart) : hstr());
+					}
+					else
+					{
+						// only carriage returns of line endings are removed, others are part of the text
+						value = hstr();
+						line = data + valueStart;
+						while (line < data + valueEnd)
+						{
+							lineEnd = (const char*)memchr(line, '\n', data + valueEnd - line);
+							if (lineEnd == NULL)
+							{
+								value += hstr(line, (int)(data + valueEnd - line));
+								break;
+							}
+							value += hstr(line, (int)((lineEnd > line && lineEnd[-1] == '\r' ? lineEnd - 1 : lineEnd) - line));
+							value += "\n";
+							line = lineEnd + 1;
+						}
+					}
+					textsMap[key] = value;
+				}
+				// preload was aborted
+				if (this->_asyncPreLoadThread != NULL && !this->_asyncPreLoading)
+				{
+					break;
+				}
+			}
+			else
+			{
+				if (valueStart < 0)
+				{
+					valueStart = (int)(line - data);
+				}
+				if (lineEnd < data + position - 1)
+				{
+					valueCarriageReturn = true;
+				}
+				valueEnd = (int)(lineEnd - data);
+			}
+		}
+	}
+
+	void Dataset::unload()
+	{
+		if (this->_asyncPreLoadThread != NULL && this->_asyncPreLoading)
+		{
+			// abort pre-load
+			this->_asyncPreLoading = false;
+			this->_asyncPreLoadThread->join();
+			delete this->_asyncPreLoadThread;
+			this->_asyncPreLoadThread = NULL;
+			// make sure to delete everything below
+			this->loaded = true;
+		}
+		else if (!this->isLoaded())
+		{
+			return;
+		}
+		this->_unload();
+	}
+	
+	void Dataset::_unload()
+	{
+		this->_closeDocuments();
+		// all objects of this dataset are destroyed together so only links to objects of other datasets have to be detached properly,
+		// the rest of the hierarchy is simply dropped instead of removing each object from its parent one by one
+		aprilui::Object* parent = NULL;
+		harray<BaseObject*> foreignChildren;
+		foreach_m (Object*, it, this->objects)
+		{
+			parent = it->second->getParent();
+			if (parent != NULL && parent->getDataset() != this)
+			{
+				parent->removeChild(it->second);
+			}
+			// children of other datasets survive the unload so they have to be detached properly as well
+			foreach (Object*, it2, it->second->childrenObjects)
+			{
+				if ((*it2)->getDataset() != this)
+				{
+					foreignChildren += (*it2);
+				}
 			}
+			foreach (Animator*, it2, it->second->childrenAnimators)
+			{
+				if ((*it2)->getDataset() != this)
+				{
+					foreignChildren += (*it2);
+				}
+			}
+			foreach (BaseObject*, it2, foreignChildren)
+			{
+				it->second->removeChild(*it2);
+			}
+			foreignChildren.clear();
+			it->second->removeChildren(false);
+		}
+		foreach_m (Animator*, it, this->animators)
+		{
+			parent = it->second->getParent();
+			if (parent != NULL) // only parents of other datasets are left at this point
+			{
+				parent->removeChild(it->second);
+			}
+		}
+		foreach_m (Animator*, it, this->animators)
+		{
+			delete it->second;
+		}
+		this->animators.clear();
+		foreach_m (Object*, it, this->objects)
+		{
+			delete it->second;
+		}
+		this->objects.clear();
+		this->objectsByNameId.clear();
+		this->_broadcastSubscribers.clear();
+		this->touchCaptures.clear();
+		this->pointerObjects.clear();
+		foreach_m (BaseImage*, it, this->images)
+		{
+			delete it->second;
+		}
+		this->images.clear();
+		this->imagesByNameId.clear();
+		foreach_m (Texture*, it, this->textures)
+		{
+			it->second->_idleScheduled = false; // avoids removal from the heap one by one
+			it->second->_loadPending = false;
+			delete it->second;
+		}
+		this->textures.clear();
+		this->_atlasTextures.clear();
+		this->_atlasImageTextures.clear();
+		this->_atlasImageSrcRects.clear();
+		this->prefetchQueue.clear();
+		this->_textureIdleDeadlines.clear();
+		this->_loadingTextures.clear();
+		foreach_m (Style*, it, this->styles)
+		{
+			delete it->second;
+		}
+		this->styles.clear();
+		this->stylesByNameId.clear();
+		this->callbacks.clear();
+		this->textureGroups.clear();
+		this->texts.clear();
+		_increaseTextsRevision();
+		this->root = NULL;
+		this->focusedObject = NULL;
+		this->loaded = false;
+		this->invalidateDrawList();
+		this->triggerEvent(aprilui::Event::DatasetUnloadedId);
+	}
+	
+	void Dataset::registerObjects(BaseObject* root, bool setRootIfNull)
+	{
+		this->invalidateDrawList();
+		this->_registerObject(root);
+		root->visitDescendants(&Dataset::_visitRegisterObject, this);
+		// notifications are sent only after the whole tree has been registered and in post-order so handlers can safely add children to the notified object
+		EventArgs args(Event::RegisteredInDataset, this);
+		root->visitDescendants(&Dataset::_visitNotifyRegistered, &args, true);
+		root->notifyEvent(Event::RegisteredInDatasetId, &args);
+		// if no root objects exists, this root becomes the new root object
+		if (this->root == NULL && setRootIfNull)
+		{
+			Object* rootObject = dynamic_cast<Object*>(root);
+			if (rootObject != NULL)
+			{
+				this->root = rootObject;
+			}
+		}
+	}
+	
+	void Dataset::_registerObject(BaseObject* object)
+	{
+		hstr name = object->getName();
+		if (this->objects.hasKey(name) || this->animators.hasKey(name))
+		{
 			// this exception cannot be disabled on purpose
-			throw ObjectNotExistsException("Object", root->getName(), this->name);
+			throw ObjectExistsException("Object", name, this->name);
 		}
-		harray<BaseObject*> children = root->getChildren();
-		foreach (BaseObject*, it, children)
+		Object* registeredObject = dynamic_cast<Object*>(object);
+		if (registeredObject != NULL)
 		{
-			this->unregisterObjects(*it);
+			this->objects[name] = registeredObject;
 		}
-		if (hasObject)
+		else
 		{
-			Object* focusedRoot = dynamic_cast<Object*>(root);
-			if (focusedRoot != NULL && focusedRoot->isFocused())
+			Animator* animator = dynamic_cast<Animator*>(object);
+			if (animator != NULL)
 			{
-				focusedRoot->setFocused(false);
+				this->animators[name] = animator;
 			}
-			this->objects.removeKey(root->getName());
 		}
-		else if (hasAnimator)
+		object->dataset = this;
+		this->_subscribeBroadcasts(object);
+	}
+
+	bool Dataset::_visitRegisterObject(BaseObject* object, void* userData)
+	{
+		((Dataset*)userData)->_registerObject(object);
+		return true;
+	}
+
+	bool Dataset::_visitNotifyRegistered(BaseObject* object, void* userData)
+	{
+		object->notifyEvent(Event::RegisteredInDatasetId, (EventArgs*)userData);
+		return true;
+	}
+
+	void Dataset::unregisterObjects(BaseObject* root)
+	{
+		if (root == NULL)
 		{
-			this->animators.removeKey(root->getName());
+			// this exception cannot be disabled on purpose
+			throw ObjectNotExistsException("Object", "NULL", this->name);
+		}
+		if (!this->objects.hasKey(root->getName()) && !this->animators.hasKey(root->getName()))
+		{
+			// this object could be from another dataset, so check that first.
+			Dataset* dataset = root->getDataset();
+			if (dataset != this)
+			{
+				hlog::writef(logTag, "Dataset '%s' unregistering object from another dataset: '%s'", this->getName().cStr(), root->getFullName().cStr());
+				dataset->unregisterObjects(root);
+				return;
+			}
+			// this exception cannot be disabled on purpose
+			throw ObjectNotExistsException("Object", root->getName(), this->name);
 		}
-		root->dataset = NULL;
+		// the subtree can be attached to the tree of another dataset which recorded it in its draw list
+		root->_invalidateDrawList();
+		root->visitDescendants(&Dataset::_visitUnregisterObject, this, true);
+		this->_unregisterObject(root);
+	}
+
+	void Dataset::_unregisterObject(BaseObject* object)
+	{
+		Object* focusedObject = dynamic_cast<Object*>(object);
+		if (focusedObject != NULL)
+		{
+			if (focusedObject->isFocused())
+			{
+				focusedObject->setFocused(false);
+			}
+			this->objects.removeKey(object->getName());
+			if (object->nameId != 0)
+			{
+				this->objectsByNameId.removeKey(object->nameId);
+			}
+			this->_releaseTouches(focusedObject);
+			this->pointerObjects.removeAll(focusedObject);
+		}
+		else if (dynamic_cast<Animator*>(object) != NULL)
+		{
+			this->animators.removeKey(object->getName());
+		}
+		this->_unsubscribeBroadcasts(object);
+		object->dataset = NULL;
+	}
+
+	bool Dataset::_visitUnregisterObject(BaseObject* object, void* userData)
+	{
+		Dataset* dataset = (Dataset*)userData;
+		if (!dataset->objects.hasKey(object->getName()) && !dataset->animators.hasKey(object->getName()))
+		{
+			// this object could be from another dataset, so check that first.
+			if (object->dataset == NULL || object->dataset == dataset)
+			{
+				// this exception cannot be disabled on purpose
+				throw ObjectNotExistsException("Object", object->getName(), dataset->name);
+			}
+			hlog::writef(logTag, "Dataset '%s' unregistering object from another dataset: '%s'", dataset->getName().cStr(), object->getFullName().cStr());
+			dataset = object->dataset;
+			dataset->invalidateDrawList();
+		}
+		dataset->_unregisterObject(object);
+		return true;
 	}
 	
+	harray<Object*> Dataset::createInstances(Object* prototype, int count, Object* parent, int firstIndex)
+	{
+		if (prototype == NULL)
+		{
+			// this exception cannot be disabled on purpose
+			throw ObjectNotExistsException("Object", "NULL", this->name);
+		}
+		harray<Object*> result;
+		// the subtree is flattened in pre-order so every parent is copied before its children
+		harray<InstanceNode> nodes;
+		Dataset::_captureInstanceNodes(prototype, -1, nodes);
+		// all names are validated before anything is cloned so a name conflict neither leaves clones behind nor registers only some of them
+		hmap<hstr, bool> names;
+		hstr name;
+		for_iter (i, 0, count)
+		{
+			foreach (InstanceNode, it, nodes)
+			{
+				name = it->prototype->name + "_" + hstr(firstIndex + i);
+				if (names.hasKey(name) || this->objects.hasKey(name) || this->animators.hasKey(name))
+				{
+					// this exception cannot be disabled on purpose
+					throw ObjectExistsException("Object", name, this->name);
+				}
+				names[name] = true;
+			}
+		}
+		harray<BaseObject*> clones;
+		harray<BaseObject*> allClones;
+		BaseObject* clone = NULL;
+		hstr suffix;
+		for_iter (i, 0, count)
+		{
+			suffix = "_" + hstr(firstIndex + i);
+			clones.clear();
+			foreach (InstanceNode, it, nodes)
+			{
+				clone = it->prototype->clone();
+				clone->name = it->prototype->name + suffix;
+				clone->nameId = 0;
+				if (it->parentIndex >= 0)
+				{
+					((Object*)clones[it->parentIndex])->_appendChild(clone);
+				}
+				clones += clone;
+			}
+			result += (Object*)clones.first();
+			allClones += clones;
+		}
+		foreach (BaseObject*, it, allClones)
+		{
+			this->_registerObject(*it);
+		}
+		EventArgs args(Event::RegisteredInDataset, this);
+		foreach (BaseObject*, it, allClones)
+		{
+			(*it)->notifyEvent(Event::RegisteredInDatasetId, &args);
+		}
+		if (parent != NULL)
+		{
+			parent->addChildren(result.cast<BaseObject*>());
+		}
+		this->invalidateDrawList();
+		this->requestUpdate();
+		return result;
+	}
+
+	void Dataset::_captureInstanceNodes(Object* object, int parentIndex, harray<InstanceNode>& nodes)
+	{
+		nodes += InstanceNode(object, parentIndex);
+		int index = nodes.size() - 1;
+		foreach (Object*, it, object->childrenObjects)
+		{
+			Dataset::_captureInstanceNodes((*it), index, nodes);
+		}
+		foreach (Animator*, it, object->childrenAnimators)
+		{
+			nodes += InstanceNode((*it), index);
+		}
+	}
+
 	void Dataset::registerTexture(Texture* texture)
 	{
 		hstr name = texture->getName();
@@ -1628,7 +2371,10 @@ namespace aprilui
 		{
 			__THROW_EXCEPTION(ObjectNotExistsException("Texture", name, this->name), aprilui::objectExistenceDebugExceptionsEnabled, return);
 		}
+		this->_removeAtlasTexture(texture);
 		this->textures.removeKey(name);
+		this->prefetchQueue.removeAll(texture);
+		this->_unscheduleTexture(texture);
 		texture->dataset = NULL;
 	}
 	
@@ -1650,7 +2396,9 @@ namespace aprilui
 		{
 			__THROW_EXCEPTION(ObjectNotExistsException("Image", name, this->name), aprilui::objectExistenceDebugExceptionsEnabled, return);
 		}
+		this->_removeAtlasImage(image);
 		this->images.removeKey(name);
+		this->imagesByNameId.clear();
 		image->dataset = NULL;
 	}
 
@@ -1673,6 +2421,7 @@ namespace aprilui
 			__THROW_EXCEPTION(ObjectNotExistsException("Style", name, this->name), aprilui::objectExistenceDebugExceptionsEnabled, return);
 		}
 		this->styles.removeKey(name);
+		this->stylesByNameId.clear();
 		style->dataset = NULL;
 	}
 
@@ -1889,6 +2638,99 @@ namespace aprilui
 		return (this->tryGetAnimator(name) != NULL);
 	}
 
+	Object* Dataset::getObjectByNameId(int nameId)
+	{
+		ASSERT_NO_ASYNC_LOADING(getObjectByNameId, (NULL));
+		Object* object = this->tryGetObjectByNameId(nameId);
+		if (object == NULL)
+		{
+			// the regular lookup takes care of proper error handling
+			object = this->getObject(aprilui::getInternedName(nameId));
+		}
+		return object;
+	}
+
+	Object* Dataset::tryGetObjectByNameId(int nameId)
+	{
+		ASSERT_NO_ASYNC_LOADING(tryGetObjectByNameId, (NULL));
+		int datasetNameId = 0;
+		int localNameId = 0;
+		if (!aprilui::_getInternedNameParts(nameId, datasetNameId, localNameId))
+		{
+			Object* object = this->objectsByNameId.tryGet(nameId, NULL);
+			if (object == NULL)
+			{
+				// the handle is resolved once and cached, the object keeps the ID so it can be removed from the cache
+				object = this->objects.tryGet(aprilui::getInternedName(nameId), NULL);
+				if (object != NULL)
+				{
+					object->nameId = nameId;
+					this->objectsByNameId[nameId] = object;
+				}
+			}
+			return object;
+		}
+		Dataset* dataset = aprilui::_getDatasetByNameId(datasetNameId);
+		return (dataset != NULL ? dataset->tryGetObjectByNameId(localNameId) : NULL);
+	}
+
+	BaseImage* Dataset::getImageByNameId(int nameId)
+	{
+		ASSERT_NO_ASYNC_LOADING(getImageByNameId, (NULL));
+		BaseImage* image = this->imagesByNameId.tryGet(nameId, NULL);
+		if (image != NULL)
+		{
+			return image;
+		}
+		hstr name = aprilui::getInternedName(nameId);
+		image = this->images.tryGet(name, NULL);
+		if (image != NULL)
+		{
+			this->imagesByNameId[nameId] = image;
+		}
+		else
+		{
+			int datasetNameId = 0;
+			int localNameId = 0;
+			Dataset* dataset = NULL;
+			if (this->_internalLoadDataset == NULL && aprilui::_getInternedNameParts(nameId, datasetNameId, localNameId))
+			{
+				dataset = aprilui::_getDatasetByNameId(datasetNameId);
+			}
+			// the regular lookup takes care of generated colors, internal datasets and proper error handling
+			image = (dataset != NULL ? dataset->getImageByNameId(localNameId) : this->_getImage(name));
+		}
+		return image;
+	}
+
+	Style* Dataset::getStyleByNameId(int nameId)
+	{
+		ASSERT_NO_ASYNC_LOADING(getStyleByNameId, (NULL));
+		Style* style = this->stylesByNameId.tryGet(nameId, NULL);
+		if (style != NULL)
+		{
+			return style;
+		}
+		hstr name = aprilui::getInternedName(nameId);
+		style = this->styles.tryGet(name, NULL);
+		if (style != NULL)
+		{
+			this->stylesByNameId[nameId] = style;
+		}
+		else
+		{
+			int datasetNameId = 0;
+			int localNameId = 0;
+			Dataset* dataset = NULL;
+			if (this->_internalLoadDataset == NULL && aprilui::_getInternedNameParts(nameId, datasetNameId, localNameId))
+			{
+				dataset = aprilui::_getDatasetByNameId(datasetNameId);
+			}
+			style = (dataset != NULL ? dataset->getStyleByNameId(localNameId) : this->getStyle(name));
+		}
+		return style;
+	}
+
 	bool Dataset::hasTexture(chstr name) const
 	{
 		ASSERT_NO_ASYNC_LOADING(hasTexture, (false));
@@ -1909,25 +2751,55 @@ namespace aprilui
 
 	bool Dataset::_findTextEntry(chstr textKey, hstr* text)
 	{
-		int dot = textKey.indexOf('.');
-		if (dot < 0)
+		// the key is split and its dataset is resolved only once, later lookups go through the cache
+		return this->_findTextEntryByNameId(aprilui::internName(textKey), text);
+	}
+
+	bool Dataset::_findTextEntryByNameId(int nameId, hstr* text)
+	{
+		int datasetNameId = 0;
+		int localNameId = 0;
+		if (aprilui::_getInternedNameParts(nameId, datasetNameId, localNameId))
 		{
-			if (!this->texts.hasKey(textKey))
+			Dataset* dataset = aprilui::_getDatasetByNameId(datasetNameId);
+			if (dataset == NULL)
 			{
-				if (text != NULL)
-				{
-					*text = "ERROR: Text '" + textKey + "' not found!";
-				}
-				return false;
+				// the regular lookup takes care of proper error handling
+				dataset = aprilui::getDatasetByName(aprilui::getInternedName(datasetNameId));
 			}
+			return dataset->_findTextEntryByNameId(localNameId, text);
+		}
+		int revision = _getTextsRevision();
+		if (this->_textsByNameIdRevision != revision)
+		{
+			this->textsByNameId.clear();
+			this->_textsByNameIdRevision = revision;
+		}
+		hmap<int, hstr>::iterator it = this->textsByNameId.find(nameId);
+		if (it != this->textsByNameId.end())
+		{
 			if (text != NULL)
 			{
-				*text = this->texts[textKey];
+				*text = it->second;
 			}
 			return true;
 		}
-		Dataset* dataset = aprilui::getDatasetByName(textKey(0, dot));
-		return dataset->_findTextEntry(textKey(dot + 1, -1), text);
+		hstr textKey = aprilui::getInternedName(nameId);
+		if (!this->texts.hasKey(textKey))
+		{
+			if (text != NULL)
+			{
+				*text = "ERROR: Text '" + textKey + "' not found!";
+			}
+			return false;
+		}
+		hstr entry = this->texts[textKey];
+		this->textsByNameId[nameId] = entry;
+		if (text != NULL)
+		{
+			*text = entry;
+		}
+		return true;
 	}
 	
 	hstr Dataset::getTextEntry(chstr textKey)
@@ -1943,11 +2815,86 @@ namespace aprilui
 		ASSERT_NO_ASYNC_LOADING(hasTextEntry, (false));
 		return this->_findTextEntry(textKey, NULL);
 	}
+
+	hstr Dataset::getTextEntryByNameId(int nameId)
+	{
+		ASSERT_NO_ASYNC_LOADING(getTextEntryByNameId, (""));
+		hstr text;
+		this->_findTextEntryByNameId(nameId, &text);
+		return text;
+	}
+
+	bool Dataset::hasTextEntryByNameId(int nameId)
+	{
+		ASSERT_NO_ASYNC_LOADING(hasTextEntryByNameId, (false));
+		return this->_findTextEntryByNameId(nameId, NULL);
+	}
 	
+	void Dataset::setTextEntry(chstr textKey, chstr text)
+	{
+		ASSERT_NO_ASYNC_LOADING(setTextEntry, ());
+		this->texts[textKey] = text;
+		_increaseTextsRevision();
+	}
+
+	bool Dataset::removeTextEntry(chstr textKey)
+	{
+		ASSERT_NO_ASYNC_LOADING(removeTextEntry, (false));
+		if (!this->texts.hasKey(textKey))
+		{
+			return false;
+		}
+		this->texts.removeKey(textKey);
+		_increaseTextsRevision();
+		return true;
+	}
+
 	hstr Dataset::getText(chstr compositeTextKey)
 	{
 		ASSERT_NO_ASYNC_LOADING(getText, (""));
-		return this->_parseCompositeTextKey(compositeTextKey);
+		if (compositeTextKey.size() == 0 || compositeTextKey[0] != '{')
+		{
+			return this->_parseCompositeTextKey(compositeTextKey);
+		}
+		int closing = compositeTextKey.indexOf('}');
+		if (closing < 0)
+		{
+			return this->_parseCompositeTextKey(compositeTextKey);
+		}
+		// literal arguments usually change with every call (e.g. formatted numbers) so they are replaced with placeholders and
+		// only the compiled template of the key structure is cached
+		hstr templateKey;
+		harray<hstr> literals;
+		if (!_makeCompositeTextTemplateKey(compositeTextKey, closing + 1, templateKey, literals))
+		{
+			return this->_parseCompositeTextKey(compositeTextKey);
+		}
+		int revision = _getTextsRevision();
+		if (this->_compositeTextsRevision != revision)
+		{
+			this->_compositeTexts.clear();
+			this->_compositeTextsRevision = revision;
+		}
+		hstr text;
+		hmap<hstr, hstr>::iterator it = this->_compositeTexts.find(templateKey);
+		if (it != this->_compositeTexts.end())
+		{
+			text = it->second;
+		}
+		else
+		{
+			text = this->_parseCompositeTextKey(templateKey);
+			if (this->_compositeTexts.size() >= APRILUI_MAX_COMPOSITE_TEXTS)
+			{
+				this->_compositeTexts.clear();
+			}
+			this->_compositeTexts[templateKey] = text;
+		}
+		for_iter (i, 0, literals.size())
+		{
+			text = text.replaced(_makeCompositeTextPlaceholder(i), literals[i]);
+		}
+		return text;
 	}
 	
 	harray<hstr> Dataset::getTexts(const harray<hstr>& keys)
@@ -1956,129 +2903,776 @@ namespace aprilui
 		harray<hstr> result;
 		foreachc (hstr, it, keys)
 		{
-			result += this->getTextEntry(*it);
+			result += this->getTextEntry(*it);
+		}
+		return result;
+	}
+
+	void Dataset::registerCallback(chstr name, void (*callback)())
+	{
+		this->callbacks[name] = callback;
+	}
+	
+	void Dataset::triggerCallback(chstr name)
+	{
+		if (this->callbacks.hasKey(name))
+		{
+			(*this->callbacks[name])();
+		}
+	}
+	
+	void Dataset::draw()
+	{
+		ASSERT_NO_ASYNC_LOADING(draw, ());
+		if (this->root == NULL)
+		{
+			return;
+		}
+		if (this->dirtyRectRedrawing && !this->_fullRedrawNeeded && _isIdentityMatrix(april::rendersys->getModelviewMatrix()))
+		{
+			this->_drawDirtyRects();
+		}
+		else
+		{
+			bool previousBoundsRecording = Dataset::_drawBoundsRecording;
+			Dataset::_drawBoundsRecording = this->dirtyRectRedrawing;
+			if (this->retainedDrawing)
+			{
+				this->_drawRetained();
+			}
+			else
+			{
+				this->root->draw();
+			}
+			Dataset::_drawBoundsRecording = previousBoundsRecording;
+		}
+		this->dirtyRects.clear();
+		this->_fullRedrawNeeded = false;
+		this->redrawNeeded = false;
+	}
+
+	void Dataset::_drawRetained()
+	{
+		gmat4 modelviewMatrix = april::rendersys->getModelviewMatrix();
+		gmat4 projectionMatrix = april::rendersys->getProjectionMatrix();
+		grecti viewport = april::rendersys->getViewport();
+		bool debug = aprilui::isDebugEnabled();
+		if (!this->_drawListValid || this->_drawListRoot != this->root || this->_drawListDebug != debug || this->_drawListViewport != viewport ||
+			memcmp(this->_drawListModelviewMatrix.data, modelviewMatrix.data, sizeof(modelviewMatrix.data)) != 0 ||
+			memcmp(this->_drawListProjectionMatrix.data, projectionMatrix.data, sizeof(projectionMatrix.data)) != 0)
+		{
+			// a regular draw is done while the draw list is being recorded
+			this->_drawList.clear();
+			this->_drawListRoot = this->root;
+			this->_drawListModelviewMatrix = modelviewMatrix;
+			this->_drawListProjectionMatrix = projectionMatrix;
+			this->_drawListViewport = viewport;
+			this->_drawListDebug = debug;
+			Dataset* previousRecorder = Dataset::_drawListRecorder;
+			Dataset::_drawListRecorder = this;
+			this->root->draw();
+			Dataset::_drawListRecorder = previousRecorder;
+			this->_drawListValid = true;
+			return;
+		}
+		bool clipped = false;
+		foreach (DrawListEntry, it, this->_drawList)
+		{
+			if ((*it).clipChanged)
+			{
+				april::rendersys->setProjectionMatrix((*it).projectionMatrix);
+				april::rendersys->setViewport((*it).viewport);
+				clipped = true;
+			}
+			april::rendersys->setModelviewMatrix((*it).modelviewMatrix);
+			(*it).object->_draw();
+			if (debug)
+			{
+				(*it).object->_drawDebug();
+			}
+		}
+		if (clipped)
+		{
+			april::rendersys->setProjectionMatrix(projectionMatrix);
+			april::rendersys->setViewport(viewport);
+		}
+		april::rendersys->setModelviewMatrix(modelviewMatrix);
+	}
+
+	void Dataset::_drawDirtyRects()
+	{
+		if (this->dirtyRects.size() == 0)
+		{
+			return;
+		}
+		gmat4 projectionMatrix = april::rendersys->getProjectionMatrix();
+		grecti viewport = april::rendersys->getViewport();
+		gvec2f viewportOffset = aprilui::getViewport().getPosition();
+		gvec2f ratio = gvec2f(viewport.getSize()) / april::rendersys->getOrthoProjection().getSize();
+		grectf rect;
+		grectf drawRect;
+		grectf newViewport;
+		grecti newViewportRect;
+		foreach (grectf, it, this->dirtyRects)
+		{
+			rect = (*it) + viewportOffset;
+			newViewport.set(rect.getPosition() * ratio, rect.getSize() * ratio);
+			newViewport.clip(viewport);
+			// pixel aligned so neighboring areas don't leave seams
+			newViewportRect.x = hfloor(newViewport.x);
+			newViewportRect.y = hfloor(newViewport.y);
+			newViewportRect.w = hceil(newViewport.x + newViewport.w) - newViewportRect.x;
+			newViewportRect.h = hceil(newViewport.y + newViewport.h) - newViewportRect.y;
+			if (newViewportRect.w <= 0 || newViewportRect.h <= 0)
+			{
+				continue;
+			}
+			rect.set(gvec2f(newViewportRect.getPosition()) / ratio, gvec2f(newViewportRect.getSize()) / ratio);
+			april::rendersys->setOrthoProjection(grectf(viewportOffset - rect.getPosition(), rect.getSize()));
+			april::rendersys->setViewport(newViewportRect);
+			drawRect.set(rect.getPosition() - viewportOffset, rect.getSize());
+			Dataset::_drawDirtyRect = &drawRect;
+			this->root->draw();
+		}
+		Dataset::_drawDirtyRect = NULL;
+		april::rendersys->setProjectionMatrix(projectionMatrix);
+		april::rendersys->setViewport(viewport);
+	}
+
+	void Dataset::setRetainedDrawing(const bool& value)
+	{
+		if (this->retainedDrawing != value)
+		{
+			this->retainedDrawing = value;
+			this->invalidateDrawList();
+		}
+	}
+
+	void Dataset::setDirtyRectRedrawing(const bool& value)
+	{
+		if (this->dirtyRectRedrawing != value)
+		{
+			this->dirtyRectRedrawing = value;
+			// the cached bounds of objects are only maintained while this is enabled
+			this->invalidateDrawList();
+		}
+	}
+
+	void Dataset::invalidateDrawList()
+	{
+		// the list itself is only cleared when recording again since this can be called during replay
+		this->_drawListValid = false;
+		this->requestRedraw();
+	}
+
+	void Dataset::requestRedraw()
+	{
+		this->redrawNeeded = true;
+		this->_fullRedrawNeeded = true;
+		this->dirtyRects.clear();
+	}
+
+	void Dataset::requestRedraw(cgrectf rect)
+	{
+		this->redrawNeeded = true;
+		if (!this->dirtyRectRedrawing)
+		{
+			this->_fullRedrawNeeded = true;
+			return;
+		}
+		if (this->_fullRedrawNeeded || rect.w <= 0.0f || rect.h <= 0.0f)
+		{
+			return;
+		}
+		// overlapping areas are merged so they are not drawn multiple times
+		grectf merged = rect;
+		int i = 0;
+		while (i < this->dirtyRects.size())
+		{
+			if (this->dirtyRects[i].intersects(merged))
+			{
+				merged = _makeUnion(merged, this->dirtyRects.removeAt(i));
+				i = 0;
+			}
+			else
+			{
+				++i;
+			}
+		}
+		this->dirtyRects += merged;
+		if (this->dirtyRects.size() > APRILUI_MAX_DIRTY_RECTS)
+		{
+			merged = this->dirtyRects.removeFirst();
+			while (this->dirtyRects.size() > 0)
+			{
+				merged = _makeUnion(merged, this->dirtyRects.removeFirst());
+			}
+			this->dirtyRects += merged;
+		}
+	}
+
+	void Dataset::requestRedraw(Object* object)
+	{
+		if (object != NULL)
+		{
+			// objects attached to the tree of another dataset are drawn by that dataset
+			Dataset* treeDataset = object->_getTreeDataset();
+			if (treeDataset != NULL && treeDataset != this)
+			{
+				treeDataset->requestRedraw(object);
+				return;
+			}
 		}
-		return result;
+		// objects without cached bounds have not been drawn yet or don't know what they cover so everything is redrawn
+		if (!this->dirtyRectRedrawing || object == NULL || object->getChildrenObjects().size() > 0 ||
+			object->_drawBoundingRect.w <= 0.0f || object->_drawBoundingRect.h <= 0.0f)
+		{
+			this->requestRedraw();
+			return;
+		}
+		this->requestRedraw(object->_drawBoundingRect);
 	}
 
-	void Dataset::registerCallback(chstr name, void (*callback)())
+	void Dataset::requestUpdate()
 	{
-		this->callbacks[name] = callback;
+		this->updateNeeded = true;
 	}
-	
-	void Dataset::triggerCallback(chstr name)
+
+	void Dataset::_recordDrawListEntry(Object* object)
 	{
-		if (this->callbacks.hasKey(name))
+		DrawListEntry entry;
+		entry.object = object;
+		entry.modelviewMatrix = april::rendersys->getModelviewMatrix();
+		entry.projectionMatrix = april::rendersys->getProjectionMatrix();
+		entry.viewport = april::rendersys->getViewport();
+		if (this->_drawList.size() > 0)
 		{
-			(*this->callbacks[name])();
+			const DrawListEntry& previous = this->_drawList.last();
+			entry.clipChanged = (previous.viewport != entry.viewport || memcmp(previous.projectionMatrix.data, entry.projectionMatrix.data, sizeof(entry.projectionMatrix.data)) != 0);
 		}
-	}
-	
-	void Dataset::draw()
-	{
-		ASSERT_NO_ASYNC_LOADING(draw, ());
-		if (this->root != NULL)
+		else
 		{
-			this->root->draw();
+			entry.clipChanged = (this->_drawListViewport != entry.viewport || memcmp(this->_drawListProjectionMatrix.data, entry.projectionMatrix.data, sizeof(entry.projectionMatrix.data)) != 0);
 		}
+		this->_drawList += entry;
 	}
 	
 	bool Dataset::onMouseDown(april::Key keyCode)
 	{
 		ASSERT_NO_ASYNC_LOADING(onMouseDown, (false));
-		return (this->root != NULL && this->root->onMouseDown(keyCode));
+		this->requestUpdate();
+		this->requestRedraw();
+		if (this->root == NULL)
+		{
+			return false;
+		}
+		bool result = this->root->onMouseDown(keyCode);
+		if (this->pointerRouting)
+		{
+			// objects that were pushed have to follow the cursor even if no move was received while it was over them
+			Object* object = this->root->getChildUnderCursor();
+			if (object != NULL && !this->pointerObjects.has(object))
+			{
+				this->pointerObjects += object;
+			}
+		}
+		return result;
 	}
 	
 	bool Dataset::onMouseUp(april::Key keyCode)
 	{
 		ASSERT_NO_ASYNC_LOADING(onMouseUp, (false));
+		this->requestUpdate();
+		this->requestRedraw();
 		return (this->root != NULL && this->root->onMouseUp(keyCode));
 	}
 	
 	bool Dataset::onMouseCancel(april::Key keyCode)
 	{
 		ASSERT_NO_ASYNC_LOADING(onMouseCancel, (false));
+		this->requestUpdate();
+		this->requestRedraw();
 		return (this->root != NULL && this->root->onMouseCancel(keyCode));
 	}
 	
 	bool Dataset::onMouseMove()
 	{
 		ASSERT_NO_ASYNC_LOADING(onMouseMove, (false));
-		return (this->root != NULL && this->root->onMouseMove());
+		this->requestUpdate();
+		if (this->root == NULL)
+		{
+			return false;
+		}
+		if (!this->pointerRouting)
+		{
+			return this->root->onMouseMove();
+		}
+		// only the objects under the cursor, the focused object and objects that are still tracking the pointer can react to a move, so the
+		// rest of the tree doesn't have to be visited
+		this->root->clearChildUnderCursor();
+		harray<Object*> objects;
+		this->_addPointerChain(objects, this->root->getChildUnderCursor());
+		this->_addPointerChain(objects, this->focusedObject);
+		foreach (Object*, it, this->pointerObjects)
+		{
+			this->_addPointerChain(objects, (*it));
+		}
+		this->pointerObjects.clear();
+		bool result = false;
+		foreach (Object*, it, objects)
+		{
+			if (!result && (*it)->isDerivedVisible() && (*it)->isDerivedEnabled())
+			{
+				result = (*it)->_mouseMove();
+			}
+			if ((*it)->_isTrackingPointer())
+			{
+				this->pointerObjects += (*it);
+			}
+		}
+		return result;
+	}
+
+	void Dataset::_addPointerChain(harray<Object*>& objects, Object* object)
+	{
+		harray<Object*> chain;
+		while (object != NULL && !objects.has(object))
+		{
+			chain += object;
+			if (object == this->root)
+			{
+				objects += chain;
+				return;
+			}
+			object = object->getParent();
+		}
+		// the rest of the chain was already added before
+		if (object != NULL)
+		{
+			objects += chain;
+		}
 	}
 	
 	bool Dataset::onMouseScroll(float x, float y)
 	{
 		ASSERT_NO_ASYNC_LOADING(onMouseScroll, (false));
+		this->requestUpdate();
+		this->requestRedraw();
 		return (this->root != NULL && this->root->onMouseScroll(x, y));
 	}
 	
 	bool Dataset::onKeyDown(april::Key keyCode)
 	{
 		ASSERT_NO_ASYNC_LOADING(onKeyDown, (false));
+		this->requestUpdate();
+		this->requestRedraw();
 		return (this->root != NULL && this->root->onKeyDown(keyCode));
 	}
 	
 	bool Dataset::onKeyUp(april::Key keyCode)
 	{
 		ASSERT_NO_ASYNC_LOADING(onKeyUp, (false));
+		this->requestUpdate();
+		this->requestRedraw();
 		return (this->root != NULL && this->root->onKeyUp(keyCode));
 	}
 	
 	bool Dataset::onChar(unsigned int charCode)
 	{
 		ASSERT_NO_ASYNC_LOADING(onChar, (false));
+		this->requestUpdate();
+		this->requestRedraw();
 		return (this->root != NULL && this->root->onChar(charCode));
 	}
 	
 	bool Dataset::onTouchDown(int index)
 	{
 		ASSERT_NO_ASYNC_LOADING(onTouchDown, (false));
+		this->requestUpdate();
+		this->requestRedraw();
 		return (this->root != NULL && this->root->onTouchDown(index));
 	}
 
 	bool Dataset::onTouchUp(int index)
 	{
 		ASSERT_NO_ASYNC_LOADING(onTouchUp, (false));
+		this->requestUpdate();
+		this->requestRedraw();
+		Object* object = this->touchCaptures.tryGet(index, NULL);
+		if (object != NULL)
+		{
+			this->touchCaptures.removeKey(index);
+			// an object that was hidden or disabled in the meantime would not receive the touch through the tree either
+			if (object->isDerivedVisible() && object->isDerivedEnabled())
+			{
+				return object->_touchUp(index);
+			}
+			object->_touchCancel(index);
+			return false;
+		}
 		return (this->root != NULL && this->root->onTouchUp(index));
 	}
 
 	bool Dataset::onTouchCancel(int index)
 	{
 		ASSERT_NO_ASYNC_LOADING(onTouchCancel, (false));
+		this->requestUpdate();
+		this->requestRedraw();
+		Object* object = this->touchCaptures.tryGet(index, NULL);
+		if (object != NULL)
+		{
+			this->touchCaptures.removeKey(index);
+			object->_touchCancel(index);
+			return false;
+		}
 		return (this->root != NULL && this->root->onTouchCancel(index));
 	}
 
 	bool Dataset::onTouchMove(int index)
 	{
 		ASSERT_NO_ASYNC_LOADING(onTouchMove, (false));
+		this->requestUpdate();
+		Object* object = this->touchCaptures.tryGet(index, NULL);
+		if (object != NULL)
+		{
+			return (object->isDerivedVisible() && object->isDerivedEnabled() && object->_touchMove(index));
+		}
 		return (this->root != NULL && this->root->onTouchMove(index));
 	}
 
 	bool Dataset::onTouch(const harray<gvec2f>& touches)
 	{
 		ASSERT_NO_ASYNC_LOADING(onTouch, (false));
+		this->requestUpdate();
+		this->requestRedraw();
 		return (this->root != NULL && this->root->onTouch(touches));
 	}
 	
 	bool Dataset::onButtonDown(april::Button buttonCode)
 	{
 		ASSERT_NO_ASYNC_LOADING(onButtonDown, (false));
+		this->requestUpdate();
+		this->requestRedraw();
 		return (this->root != NULL && this->root->onButtonDown(buttonCode));
 	}
 	
 	bool Dataset::onButtonUp(april::Button buttonCode)
 	{
 		ASSERT_NO_ASYNC_LOADING(onButtonUp, (false));
+		this->requestUpdate();
+		this->requestRedraw();
 		return (this->root != NULL && this->root->onButtonUp(buttonCode));
 	}
 	
+	void Dataset::captureTouch(int index, Object* object)
+	{
+		if (object == NULL)
+		{
+			this->releaseTouch(index);
+			return;
+		}
+		if (object->getDataset() != this)
+		{
+			hlog::errorf(logTag, "Cannot capture touch %d in dataset '%s', object '%s' is not registered in it!", index, this->name.cStr(), object->getName().cStr());
+			return;
+		}
+		this->touchCaptures[index] = object;
+	}
+
+	void Dataset::releaseTouch(int index)
+	{
+		this->touchCaptures.removeKey(index);
+	}
+
+	Object* Dataset::getTouchCapture(int index) const
+	{
+		return this->touchCaptures.tryGet(index, NULL);
+	}
+
+	void Dataset::_releaseTouches(Object* object)
+	{
+		if (this->touchCaptures.size() > 0)
+		{
+			harray<int> indices = this->touchCaptures.keys();
+			Object* captured = NULL;
+			foreach (int, it, indices)
+			{
+				// captures of descendants are released as well
+				captured = this->touchCaptures[*it];
+				while (captured != NULL && captured != object)
+				{
+					captured = captured->getParent();
+				}
+				if (captured != NULL)
+				{
+					this->touchCaptures.removeKey(*it);
+				}
+			}
+		}
+	}
+
 	void Dataset::updateTextures(float timeDelta)
 	{
 		ASSERT_NO_ASYNC_LOADING(updateTextures, ());
+		this->_textureTime += timeDelta;
+		// only textures that are still loading have to be checked, idle textures are found through their deadlines
+		if (this->_loadingTextures.size() > 0)
+		{
+			harray<Texture*> loadingTextures = this->_loadingTextures;
+			this->_loadingTextures.clear();
+			foreach (Texture*, it, loadingTextures)
+			{
+				(*it)->update(timeDelta);
+				if ((*it)->isAsyncLoadQueued() && !(*it)->isReadyForUpload())
+				{
+					this->_loadingTextures += (*it);
+				}
+				else
+				{
+					(*it)->_loadPending = false;
+				}
+			}
+		}
+		this->_updateTextureIdleDeadlines();
+		if (this->prefetchQueue.size() > 0)
+		{
+			this->_updateTexturePrefetching();
+		}
+	}
+
+	void Dataset::_scheduleTextureIdleDeadline(Texture* texture)
+	{
+		this->_textureIdleDeadlines += TextureIdleDeadline(texture->_idleStartTime + this->_textureIdleUnloadTime, texture);
+		std::push_heap(this->_textureIdleDeadlines.begin(), this->_textureIdleDeadlines.end());
+		texture->_idleScheduled = true;
+	}
+
+	void Dataset::_unscheduleTexture(Texture* texture)
+	{
+		if (texture->_idleScheduled)
+		{
+			for_iter (i, 0, this->_textureIdleDeadlines.size())
+			{
+				if (this->_textureIdleDeadlines[i].texture == texture)
+				{
+					this->_textureIdleDeadlines.removeAt(i);
+					break;
+				}
+			}
+			std::make_heap(this->_textureIdleDeadlines.begin(), this->_textureIdleDeadlines.end());
+			texture->_idleScheduled = false;
+		}
+		if (texture->_loadPending)
+		{
+			this->_loadingTextures.removeAll(texture);
+			texture->_loadPending = false;
+		}
+	}
+
+	void Dataset::_updateTextureIdleDeadlines()
+	{
+		float maxTime = aprilui::getTextureIdleUnloadTime();
+		if (this->_textureIdleUnloadTime != maxTime)
+		{
+			this->_textureIdleUnloadTime = maxTime;
+			this->_rescheduleTextureIdleDeadlines();
+		}
+		Texture* texture = NULL;
+		while (this->_textureIdleDeadlines.size() > 0 && this->_textureIdleDeadlines.first().time <= this->_textureTime)
+		{
+			texture = this->_textureIdleDeadlines.first().texture;
+			std::pop_heap(this->_textureIdleDeadlines.begin(), this->_textureIdleDeadlines.end());
+			this->_textureIdleDeadlines.removeLast();
+			texture->_idleScheduled = false;
+			if (!texture->managed || texture->texture == NULL || texture->texture->isUnloaded())
+			{
+				continue; // scheduled again when it's used the next time
+			}
+			// deadlines are not updated when a texture is used so they are checked lazily here
+			if (texture->_idleStartTime + maxTime > this->_textureTime)
+			{
+				this->_scheduleTextureIdleDeadline(texture);
+				continue;
+			}
+			texture->unload();
+		}
+	}
+
+	void Dataset::_rescheduleTextureIdleDeadlines()
+	{
+		foreach (TextureIdleDeadline, it, this->_textureIdleDeadlines)
+		{
+			it->texture->_idleScheduled = false;
+		}
+		this->_textureIdleDeadlines.clear();
+		// nothing is scheduled while idle unloading is disabled
+		if (this->_textureIdleUnloadTime > 0.0f)
+		{
+			foreach_m (Texture*, it, this->textures)
+			{
+				if (it->second->managed && it->second->texture != NULL && !it->second->texture->isUnloaded())
+				{
+					this->_scheduleTextureIdleDeadline(it->second);
+				}
+			}
+		}
+	}
+
+	hmap<hstr, int64_t> Dataset::getMemoryFootprint()
+	{
+		hmap<hstr, int64_t> result;
+		result["objects"] = 0LL;
+		result["animators"] = 0LL;
+		result["images"] = 0LL;
+		result["image_caches"] = 0LL;
+		result["styles"] = 0LL;
+		result["texts"] = 0LL;
+		result["textures"] = 0LL;
+		foreach_m (Object*, it, this->objects)
+		{
+			result["objects"] += it->second->getByteSize();
+		}
+		foreach_m (Animator*, it, this->animators)
+		{
+			result["animators"] += it->second->getByteSize();
+		}
+		foreach_m (BaseImage*, it, this->images)
+		{
+			result["images"] += it->second->getByteSize();
+			result["image_caches"] += it->second->getCacheByteSize();
+		}
+		foreach_m (Style*, it, this->styles)
+		{
+			result["styles"] += it->second->getByteSize();
+		}
+		foreach_m (hstr, it, this->texts)
+		{
+			result["texts"] += (int64_t)(it->first.size() + it->second.size() + sizeof(hstr) * 2);
+		}
 		foreach_m (Texture*, it, this->textures)
 		{
-			it->second->update(timeDelta);
+			result["textures"] += it->second->getByteSize();
+		}
+		return result;
+	}
+
+	void Dataset::dumpMemoryFootprint(int maxEntries)
+	{
+		hmap<hstr, int64_t> footprint = this->getMemoryFootprint();
+		int64_t cpuTotal = 0LL;
+		foreach_m (int64_t, it, footprint)
+		{
+			if (it->first != "textures")
+			{
+				cpuTotal += it->second;
+			}
+		}
+		hlog::writef(logTag, "Memory footprint of dataset '%s': %lld bytes CPU, %lld bytes GPU", this->name.cStr(), (long long)cpuTotal, (long long)footprint["textures"]);
+		foreach_m (int64_t, it, footprint)
+		{
+			hlog::writef(logTag, "  %s: %lld bytes", it->first.cStr(), (long long)it->second);
+		}
+		harray<std::pair<hstr, int64_t> > entries;
+		foreach_m (Object*, it, this->objects)
+		{
+			entries += std::pair<hstr, int64_t>("object " + it->first, it->second->getByteSize());
+		}
+		foreach_m (Animator*, it, this->animators)
+		{
+			entries += std::pair<hstr, int64_t>("animator " + it->first, it->second->getByteSize());
+		}
+		foreach_m (BaseImage*, it, this->images)
+		{
+			entries += std::pair<hstr, int64_t>("image " + it->first, it->second->getByteSize() + it->second->getCacheByteSize());
+		}
+		foreach_m (Texture*, it, this->textures)
+		{
+			entries += std::pair<hstr, int64_t>("texture " + it->first, it->second->getByteSize());
+		}
+		HL_LAMBDA_CLASS(_sortEntries, bool, ((std::pair<hstr, int64_t> const& a, std::pair<hstr, int64_t> const& b) { return (a.second > b.second); }));
+		entries.sort(&_sortEntries::lambda);
+		int count = hmin(maxEntries, entries.size());
+		hlog::writef(logTag, "Biggest %d contributors:", count);
+		for_iter (i, 0, count)
+		{
+			hlog::writef(logTag, "  %s: %lld bytes", entries[i].first.cStr(), (long long)entries[i].second);
+		}
+	}
+
+	void Dataset::prefetchTextures(Object* root)
+	{
+		ASSERT_NO_ASYNC_LOADING(prefetchTextures, ());
+		harray<BaseImage*> images = root->getUsedImages();
+		root->visitDescendantsByType<Object>(&Dataset::_visitUsedImages, &images);
+		harray<Texture*> textures = BaseImage::findTextures(images);
+		int size = textures.size();
+		for_iter (i, 0, size)
+		{
+			textures += textures[i]->getLinks();
+		}
+		textures.removeDuplicates();
+		// textures are queued in their own datasets so they can be removed safely when they are destroyed
+		foreach (Texture*, it, textures)
+		{
+			if ((*it)->dataset != NULL && (*it)->isUnloaded() && !(*it)->dataset->prefetchQueue.has(*it))
+			{
+				// prefetched textures count as used so the memory budget does not unload them before they are shown
+				(*it)->markUsed();
+				(*it)->dataset->prefetchQueue += (*it);
+				(*it)->dataset->requestUpdate();
+			}
+		}
+	}
+
+	bool Dataset::_visitUsedImages(Object* object, void* userData)
+	{
+		(*(harray<BaseImage*>*)userData) += object->getUsedImages();
+		return true;
+	}
+
+	void Dataset::prefetchTextures(chstr objectName)
+	{
+		Object* object = this->getObject(objectName);
+		if (object != NULL)
+		{
+			this->prefetchTextures(object);
+		}
+	}
+
+	void Dataset::cancelTexturePrefetching()
+	{
+		this->prefetchQueue.clear();
+	}
+
+	void Dataset::_updateTexturePrefetching()
+	{
+		int64_t budget = aprilui::getTexturePrefetchBudget();
+		int64_t size = 0;
+		int64_t total = 0;
+		Texture* texture = NULL;
+		while (this->prefetchQueue.size() > 0)
+		{
+			texture = this->prefetchQueue.first();
+			if (!texture->isUnloaded())
+			{
+				this->prefetchQueue.removeFirst();
+				continue;
+			}
+			texture->loadMetaData(true);
+			size = (int64_t)texture->getTexture()->getWidth() * texture->getTexture()->getHeight() * 4;
+			if (budget > 0 && total > 0 && total + size > budget)
+			{
+				break;
+			}
+			this->prefetchQueue.removeFirst();
+			// links have already been queued separately
+			texture->markUsed();
+			texture->loadAsync(true);
+			total += size;
+		}
+		if (this->prefetchQueue.size() > 0)
+		{
+			this->requestUpdate();
 		}
 	}
 	
@@ -2132,6 +3726,8 @@ namespace aprilui
 	void Dataset::update(float timeDelta)
 	{
 		ASSERT_NO_ASYNC_LOADING(update, ());
+		// anything that still has work to do requests another update during this call
+		this->updateNeeded = false;
 		this->updateTextures(timeDelta);
 		if (this->root != NULL && this->root->getParent() == NULL)
 		{
@@ -2148,13 +3744,73 @@ namespace aprilui
 		}
 	}
 
-	void Dataset::notifyEvent(chstr type, EventArgs* args)
+	void Dataset::_notifyEvent(int typeId, EventArgs* args)
 	{
-		ASSERT_NO_ASYNC_LOADING(notifyEvent, ());
+		ASSERT_NO_ASYNC_LOADING(_notifyEvent, ());
+		if (this->subscribedBroadcasting)
+		{
+			if (this->_broadcastSubscribers.hasKey(typeId))
+			{
+				harray<BaseObject*> objects = this->_broadcastSubscribers[typeId].objects; // events might subscribe or unsubscribe objects
+				foreach (BaseObject*, it, objects)
+				{
+					(*it)->notifyEvent(typeId, args);
+				}
+				return;
+			}
+		}
 		harray<BaseObject*> allObjects = this->objects.values().cast<BaseObject*>() + this->animators.values().cast<BaseObject*>(); // events might delete objects
 		foreach (BaseObject*, it, allObjects)
 		{
-			(*it)->notifyEvent(type, args);
+			(*it)->notifyEvent(typeId, args);
+		}
+	}
+
+	void Dataset::_subscribeBroadcasts(BaseObject* object)
+	{
+		foreach (int, it, object->_broadcastTypeIds)
+		{
+			this->_addBroadcastSubscriber((*it), object);
+		}
+	}
+
+	void Dataset::_unsubscribeBroadcasts(BaseObject* object)
+	{
+		foreach (int, it, object->_broadcastTypeIds)
+		{
+			this->_removeBroadcastSubscriber((*it), object);
+		}
+	}
+
+	void Dataset::_addBroadcastSubscriber(int typeId, BaseObject* object)
+	{
+		BroadcastSubscribers& subscribers = this->_broadcastSubscribers[typeId];
+		if (!subscribers.indices.hasKey(object))
+		{
+			subscribers.indices[object] = subscribers.objects.size();
+			subscribers.objects += object;
+		}
+	}
+
+	void Dataset::_removeBroadcastSubscriber(int typeId, BaseObject* object)
+	{
+		if (this->_broadcastSubscribers.hasKey(typeId))
+		{
+			BroadcastSubscribers& subscribers = this->_broadcastSubscribers[typeId];
+			int index = subscribers.indices.tryGet(object, -1);
+			if (index >= 0)
+			{
+				// the last subscriber takes the place of the removed one so nothing has to be shifted
+				BaseObject* last = subscribers.objects.last();
+				subscribers.objects[index] = last;
+				subscribers.indices[last] = index;
+				subscribers.objects.removeLast();
+				subscribers.indices.removeKey(object);
+				if (subscribers.objects.size() == 0)
+				{
+					this->_broadcastSubscribers.removeKey(typeId);
+				}
+			}
 		}
 	}
 
@@ -2175,19 +3831,37 @@ namespace aprilui
 	{
 		ASSERT_NO_ASYNC_LOADING(reloadTexts, ());
 		this->texts.clear();
+		_increaseTextsRevision();
 		foreach (hstr, it, this->textsPaths)
 		{
 			this->_loadTexts(this->_makeTextsPath(*it));
 		}
 	}
 	
+	void Dataset::clearCompositeTextsCache()
+	{
+		// other datasets can have cached composite texts that reference these texts as well
+		_increaseTextsRevision();
+		this->_compositeTexts.clear();
+	}
+
 	void Dataset::reloadTextures()
 	{
 		ASSERT_NO_ASYNC_LOADING(reloadTextures, ());
+		// atlas pages have no file of their own so they are rebuilt from the reloaded textures instead
+		bool atlasesBuilt = (this->_atlasTextures.size() > 0);
+		if (atlasesBuilt)
+		{
+			this->_destroyTextureAtlases();
+		}
 		foreach_m (aprilui::Texture*, it, this->textures)
 		{
 			it->second->reload(this->_makeLocalizedTextureName(it->second->getOriginalFilename()));
 		}
+		if (atlasesBuilt && aprilui::getTextureAtlasPageSize() > 0)
+		{
+			this->_buildTextureAtlases();
+		}
 	}
 
 	void Dataset::focus(Object* object)
@@ -2195,8 +3869,9 @@ namespace aprilui
 		ASSERT_NO_ASYNC_LOADING(focus, ());
 		this->removeFocus();
 		this->focusedObject = object;
-		this->focusedObject->notifyEvent(Event::FocusGained, NULL);
-		this->focusedObject->triggerEvent(Event::FocusGained);
+		this->requestRedraw();
+		this->focusedObject->notifyEvent(Event::FocusGainedId, NULL);
+		this->focusedObject->triggerEvent(Event::FocusGainedId);
 	}
 
 	void Dataset::removeFocus()
@@ -2208,7 +3883,8 @@ namespace aprilui
 			// in case of a recursive call, the focused object has to be removed first.
 			aprilui::Object* object = this->focusedObject;
 			this->focusedObject = NULL;
-			object->triggerEvent(Event::FocusLost);
+			this->requestRedraw();
+			object->triggerEvent(Event::FocusLostId);
 		}
 	}
 	
@@ -2223,11 +3899,12 @@ namespace aprilui
 				hlog::error(logTag, text);
 				return text;
 			}
-			if (!this->hasTextEntry(key))
+			hstr text;
+			if (!this->_findTextEntry(key, &text))
 			{
 				hlog::warnf(logTag, "Text key '%s' does not exist!", key.cStr());
 			}
-			return this->getTextEntry(key);
+			return text;
 		}
 		int index = (int)uChars.find_first_of('}');
 		if (index < 0)
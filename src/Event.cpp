@@ -6,7 +6,10 @@
 /// This program is free software; you can redistribute it and/or modify it under
 /// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
 
+#include <hltypes/harray.h>
 #include <hltypes/hlog.h>
+#include <hltypes/hmap.h>
+#include <hltypes/hmutex.h>
 #include <hltypes/hstring.h>
 
 #include "aprilui.h"
@@ -118,4 +121,112 @@ namespace aprilui
 		return false;
 	}
 
+	// system event types are registered during static initialization in the order of Event::TypeId, they never change afterwards so they can be looked up without locking
+	static harray<hstr> _makeSystemTypeNames()
+	{
+		harray<hstr> result;
+		result += hstr();
+		result += Event::DatasetLoaded;
+		result += Event::DatasetUnloaded;
+		result += Event::RegisteredInDataset;
+		result += Event::UnregisteredFromDataset;
+		result += Event::TextureLoaded;
+		result += Event::TextureUnloaded;
+		result += Event::AttachedToObject;
+		result += Event::DetachedFromObject;
+		result += Event::MouseDown;
+		result += Event::MouseUp;
+		result += Event::MouseMove;
+		result += Event::MouseScroll;
+		result += Event::MouseCancel;
+		result += Event::Click;
+		result += Event::KeyDown;
+		result += Event::KeyUp;
+		result += Event::TouchDown;
+		result += Event::TouchUp;
+		result += Event::TouchMove;
+		result += Event::TouchCancel;
+		result += Event::Tap;
+		result += Event::ButtonDown;
+		result += Event::ButtonUp;
+		result += Event::ButtonTrigger;
+		result += Event::EnabledChanged;
+		result += Event::AwakeChanged;
+		result += Event::PositionChanged;
+		result += Event::SizeChanged;
+		result += Event::FocusGained;
+		result += Event::FocusLost;
+		result += Event::HoverStarted;
+		result += Event::HoverFinished;
+		result += Event::TextChanged;
+		result += Event::TextKeyChanged;
+		result += Event::LocalizationChanged;
+		result += Event::SubmitEditText;
+		result += Event::ScrollSkinChanged;
+		result += Event::SetProgressValue;
+		result += Event::SelectedChanged;
+		result += Event::NodeExpanded;
+		result += Event::NodeCollapsed;
+		result += Event::AnimationDelayExpired;
+		result += Event::AnimationExpired;
+		return result;
+	}
+
+	static hmap<hstr, int> _makeSystemTypeIds(const harray<hstr>& typeNames)
+	{
+		hmap<hstr, int> result;
+		for_iter (i, 1, typeNames.size())
+		{
+			result[typeNames[i]] = i;
+		}
+		return result;
+	}
+
+	static harray<hstr> systemTypeNames = _makeSystemTypeNames();
+	static hmap<hstr, int> systemTypeIds = _makeSystemTypeIds(systemTypeNames);
+	// custom event types can be registered from loading threads
+	static harray<hstr> customTypeNames;
+	static hmap<hstr, int> customTypeIds;
+	static hmutex customTypeIdsMutex;
+
+	int Event::getTypeId(chstr type)
+	{
+		int typeId = systemTypeIds.tryGet(type, InvalidTypeId);
+		if (typeId != InvalidTypeId || type == "")
+		{
+			return typeId;
+		}
+		hmutex::ScopeLock lock(&customTypeIdsMutex);
+		typeId = customTypeIds.tryGet(type, InvalidTypeId);
+		if (typeId == InvalidTypeId)
+		{
+			typeId = FirstCustomTypeId + customTypeNames.size();
+			customTypeNames += type;
+			customTypeIds[type] = typeId;
+		}
+		return typeId;
+	}
+
+	int Event::findTypeId(chstr type)
+	{
+		int typeId = systemTypeIds.tryGet(type, InvalidTypeId);
+		if (typeId != InvalidTypeId || type == "")
+		{
+			return typeId;
+		}
+		hmutex::ScopeLock lock(&customTypeIdsMutex);
+		return customTypeIds.tryGet(type, InvalidTypeId);
+	}
+
+	hstr Event::getTypeName(int typeId)
+	{
+		if (typeId < FirstCustomTypeId)
+		{
+			return (typeId > InvalidTypeId ? systemTypeNames[typeId] : hstr());
+		}
+		hmutex::ScopeLock lock(&customTypeIdsMutex);
+		typeId -= FirstCustomTypeId;
+		return (typeId < customTypeNames.size() ? customTypeNames[typeId] : hstr());
+	}
+
 }
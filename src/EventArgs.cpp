@@ -8,6 +8,7 @@
 
 #include "Animator.h"
 #include "Dataset.h"
+#include "Event.h"
 #include "EventArgs.h"
 #include "Object.h"
 
@@ -144,6 +145,7 @@ namespace aprilui
 	void EventArgs::_initDefaults(chstr eventType)
 	{
 		this->eventType = eventType;
+		this->eventTypeId = Event::findTypeId(eventType);
 		this->receiver = NULL;
 		this->baseObject = NULL;
 		this->object = NULL;
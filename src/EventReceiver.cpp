@@ -30,23 +30,35 @@ namespace aprilui
 		Cloneable(other)
 	{
 		this->dataset = NULL;
-		foreachc_m (Event*, it, other.events)
+		this->eventTypeIds = other.eventTypeIds;
+		foreachc (Event*, it, other.eventHandlers)
 		{
-			this->events[it->first] = it->second->clone();
+			this->eventHandlers += (*it)->clone();
 		}
 	}
 	
 	EventReceiver::~EventReceiver()
 	{
-		foreach_m (Event*, it, this->events)
+		foreach (Event*, it, this->eventHandlers)
 		{
 			if (this->dataset != NULL)
 			{
-				this->dataset->removeCallbackFromQueue(it->second);
+				this->dataset->removeCallbackFromQueue(*it);
 			}
-			delete it->second;
+			delete (*it);
 		}
-		this->events.clear();
+		this->eventTypeIds.clear();
+		this->eventHandlers.clear();
+	}
+
+	hmap<hstr, Event*> EventReceiver::getEvents() const
+	{
+		hmap<hstr, Event*> result;
+		for_iter (i, 0, this->eventTypeIds.size())
+		{
+			result[Event::getTypeName(this->eventTypeIds[i])] = this->eventHandlers[i];
+		}
+		return result;
 	}
 
 	bool EventReceiver::registerEvent(chstr type, void(*callback)(EventArgs*))
@@ -65,7 +77,8 @@ namespace aprilui
 		if (event != NULL)
 		{
 			this->unregisterEvent(type);
-			this->events[type] = event;
+			this->eventTypeIds += Event::getTypeId(type);
+			this->eventHandlers += event;
 			return true;
 		}
 		return false;
@@ -73,15 +86,17 @@ namespace aprilui
 
 	bool EventReceiver::unregisterEvent(chstr type)
 	{
-		if (this->events.hasKey(type))
+		Event* event = this->_findEvent(type);
+		if (event != NULL)
 		{
-			Event* event = this->events[type];
 			if (this->dataset != NULL)
 			{
 				this->dataset->removeCallbackFromQueue(event);
 			}
+			int index = this->eventHandlers.indexOf(event);
+			this->eventTypeIds.removeAt(index);
+			this->eventHandlers.removeAt(index);
 			delete event;
-			this->events.removeKey(type);
 			return true;
 		}
 		return false;
@@ -89,68 +104,133 @@ namespace aprilui
 
 	bool EventReceiver::isEventRegistered(chstr type) const
 	{
-		return this->events.hasKey(type);
+		return (this->_findEvent(type) != NULL);
+	}
+
+	Event* EventReceiver::getEvent(int typeId) const
+	{
+		int size = this->eventTypeIds.size();
+		for_iter (i, 0, size)
+		{
+			if (this->eventTypeIds[i] == typeId)
+			{
+				return this->eventHandlers[i];
+			}
+		}
+		return NULL;
+	}
+
+	Event* EventReceiver::_findEvent(chstr type) const
+	{
+		// most receivers have no handlers at all so the type doesn't even have to be looked up
+		return (this->eventHandlers.size() > 0 ? this->getEvent(Event::findTypeId(type)) : NULL);
 	}
 
 	void EventReceiver::notifyEvent(chstr type, EventArgs* args)
+	{
+		this->_notifyEvent(Event::getTypeId(type), args);
+	}
+
+	void EventReceiver::notifyEvent(int typeId, EventArgs* args)
+	{
+		this->_notifyEvent(typeId, args);
+	}
+
+	void EventReceiver::_notifyEvent(int typeId, EventArgs* args)
 	{
 	}
 
 	bool EventReceiver::triggerEvent(chstr type, april::Key keyCode)
 	{
-		if (this->events.hasKey(type))
+		return (this->eventHandlers.size() > 0 && this->triggerEvent(Event::findTypeId(type), keyCode));
+	}
+
+	bool EventReceiver::triggerEvent(chstr type, april::Key keyCode, chstr string)
+	{
+		return (this->eventHandlers.size() > 0 && this->triggerEvent(Event::findTypeId(type), keyCode, string));
+	}
+
+	bool EventReceiver::triggerEvent(chstr type, april::Key keyCode, cgvec2f position, chstr string, void* userData)
+	{
+		return (this->eventHandlers.size() > 0 && this->triggerEvent(Event::findTypeId(type), keyCode, position, string, userData));
+	}
+
+	bool EventReceiver::triggerEvent(chstr type, april::Button buttonCode, chstr string, void* userData)
+	{
+		return (this->eventHandlers.size() > 0 && this->triggerEvent(Event::findTypeId(type), buttonCode, string, userData));
+	}
+
+	bool EventReceiver::triggerEvent(chstr type, chstr string, void* userData)
+	{
+		return (this->eventHandlers.size() > 0 && this->triggerEvent(Event::findTypeId(type), string, userData));
+	}
+
+	bool EventReceiver::triggerEvent(chstr type, void* userData)
+	{
+		return (this->eventHandlers.size() > 0 && this->triggerEvent(Event::findTypeId(type), userData));
+	}
+
+	bool EventReceiver::triggerEvent(int typeId, april::Key keyCode)
+	{
+		Event* event = this->getEvent(typeId);
+		if (event != NULL)
 		{
-			this->dataset->queueCallback(this->events[type], new EventArgs(type, this, keyCode, aprilui::getCursorPosition(), "", NULL));
+			this->dataset->queueCallback(event, new EventArgs(Event::getTypeName(typeId), this, keyCode, aprilui::getCursorPosition(), "", NULL));
 			return true;
 		}
 		return false;
 	}
 
-	bool EventReceiver::triggerEvent(chstr type, april::Key keyCode, chstr string)
+	bool EventReceiver::triggerEvent(int typeId, april::Key keyCode, chstr string)
 	{
-		if (this->events.hasKey(type))
+		Event* event = this->getEvent(typeId);
+		if (event != NULL)
 		{
-			this->dataset->queueCallback(this->events[type], new EventArgs(type, this, keyCode, aprilui::getCursorPosition(), string, NULL));
+			this->dataset->queueCallback(event, new EventArgs(Event::getTypeName(typeId), this, keyCode, aprilui::getCursorPosition(), string, NULL));
 			return true;
 		}
 		return false;
 	}
 
-	bool EventReceiver::triggerEvent(chstr type, april::Key keyCode, cgvec2f position, chstr string, void* userData)
+	bool EventReceiver::triggerEvent(int typeId, april::Key keyCode, cgvec2f position, chstr string, void* userData)
 	{
-		if (this->events.hasKey(type))
+		Event* event = this->getEvent(typeId);
+		if (event != NULL)
 		{
-			this->dataset->queueCallback(this->events[type], new EventArgs(type, this, keyCode, position, string, userData));
+			this->dataset->queueCallback(event, new EventArgs(Event::getTypeName(typeId), this, keyCode, position, string, userData));
 			return true;
 		}
 		return false;
 	}
 
-	bool EventReceiver::triggerEvent(chstr type, april::Button buttonCode, chstr string, void* userData)
+	bool EventReceiver::triggerEvent(int typeId, april::Button buttonCode, chstr string, void* userData)
 	{
-		if (this->events.hasKey(type))
+		Event* event = this->getEvent(typeId);
+		if (event != NULL)
 		{
-			this->dataset->queueCallback(this->events[type], new EventArgs(type, this, buttonCode, string, userData));
+			this->dataset->queueCallback(event, new EventArgs(Event::getTypeName(typeId), this, buttonCode, string, userData));
 			return true;
 		}
 		return false;
 	}
 
-	bool EventReceiver::triggerEvent(chstr type, chstr string, void* userData)
+	bool EventReceiver::triggerEvent(int typeId, chstr string, void* userData)
 	{
-		if (this->events.hasKey(type))
+		Event* event = this->getEvent(typeId);
+		if (event != NULL)
 		{
-			this->dataset->queueCallback(this->events[type], new EventArgs(type, this, string, userData));
+			this->dataset->queueCallback(event, new EventArgs(Event::getTypeName(typeId), this, string, userData));
 			return true;
 		}
 		return false;
 	}
 
-	bool EventReceiver::triggerEvent(chstr type, void* userData)
+	bool EventReceiver::triggerEvent(int typeId, void* userData)
 	{
-		if (this->events.hasKey(type))
+		Event* event = this->getEvent(typeId);
+		if (event != NULL)
 		{
-			this->dataset->queueCallback(this->events[type], new EventArgs(type, this, userData));
+			this->dataset->queueCallback(event, new EventArgs(Event::getTypeName(typeId), this, userData));
 			return true;
 		}
 		return false;
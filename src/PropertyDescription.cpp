@@ -6,6 +6,9 @@
 /// This program is free software; you can redistribute it and/or modify it under
 /// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
 
+#include <hltypes/harray.h>
+#include <hltypes/hmap.h>
+#include <hltypes/hmutex.h>
 #include <hltypes/hstring.h>
 
 #include "aprilui.h"
@@ -29,6 +32,13 @@ namespace aprilui
 		HL_ENUM_DEFINE(PropertyDescription::Type, Color);
 	));
 
+	hmap<hstr, int> PropertyDescription::_ids;
+	harray<hstr> PropertyDescription::_names;
+	hmap<hmap<hstr, PropertyDescription::Accessor*>*, harray<PropertyDescription::Accessor*> > PropertyDescription::_accessorTables;
+
+	// property IDs and tables can be created from loading threads
+	static hmutex idsMutex;
+
 	PropertyDescription::PropertyDescription()
 	{
 		this->name = "";
@@ -43,4 +53,48 @@ namespace aprilui
 		this->arrayData = arrayData;
 	}
 
+	int PropertyDescription::findId(chstr name)
+	{
+		hmutex::ScopeLock lock(&idsMutex);
+		return PropertyDescription::_findId(name);
+	}
+
+	hstr PropertyDescription::findNameById(int id)
+	{
+		hmutex::ScopeLock lock(&idsMutex);
+		return (id >= 0 && id < PropertyDescription::_names.size() ? PropertyDescription::_names[id] : hstr(""));
+	}
+
+	const harray<PropertyDescription::Accessor*>& PropertyDescription::getAccessorTable(hmap<hstr, Accessor*>& accessors)
+	{
+		hmutex::ScopeLock lock(&idsMutex);
+		harray<Accessor*>* table = &PropertyDescription::_accessorTables[&accessors];
+		if (table->size() == 0 && accessors.size() > 0)
+		{
+			int id = 0;
+			foreach_m (Accessor*, it, accessors)
+			{
+				id = PropertyDescription::_findId(it->first);
+				if (id >= table->size())
+				{
+					table->add(NULL, id + 1 - table->size());
+				}
+				(*table)[id] = it->second;
+			}
+		}
+		return (*table);
+	}
+
+	int PropertyDescription::_findId(chstr name)
+	{
+		int id = PropertyDescription::_ids.tryGet(name, -1);
+		if (id < 0)
+		{
+			id = PropertyDescription::_names.size();
+			PropertyDescription::_ids[name] = id;
+			PropertyDescription::_names += name;
+		}
+		return id;
+	}
+
 }
@@ -7,6 +7,7 @@
 /// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
 
 #include <hltypes/hlog.h>
+#include <hltypes/hmutex.h>
 #include <hltypes/hmap.h>
 #include <hltypes/hstring.h>
 
@@ -16,6 +17,17 @@
 
 namespace aprilui
 {
+	// revisions are unique across all styles so a recreated style at the same address can't be mistaken for a cached one
+	static int _lastRevision = 0;
+	static hmutex _revisionMutex;
+
+	static int _makeRevision()
+	{
+		hmutex::ScopeLock lock(&_revisionMutex);
+		++_lastRevision;
+		return _lastRevision;
+	}
+
 	Style::Group::Group(hmap<hstr, hstr> properties)
 	{
 		this->properties = properties;
@@ -26,6 +38,7 @@ namespace aprilui
 	{
 		this->name = name;
 		this->dataset = NULL;
+		this->_revision = _makeRevision();
 	}
 
 	Style::Style(const Style& other) :
@@ -37,6 +50,12 @@ namespace aprilui
 		this->animatorDefaults = other.animatorDefaults;
 		this->objects = other.objects;
 		this->animators = other.animators;
+		this->_revision = _makeRevision();
+	}
+
+	Style::~Style()
+	{
+		this->_clearInjectedStyles();
 	}
 
 	hstr Style::getFullName() const
@@ -44,6 +63,36 @@ namespace aprilui
 		return (this->dataset != NULL ? this->dataset->getName() + "." + this->name : this->name);
 	}
 
+	int64_t Style::getByteSize() const
+	{
+		int64_t result = (int64_t)(sizeof(Style) + this->name.size());
+		harray<const Group*> groups;
+		groups += &this->objectDefaults;
+		groups += &this->animatorDefaults;
+		for (hmap<hstr, Group>::const_iterator it = this->objects.begin(); it != this->objects.end(); ++it)
+		{
+			result += (int64_t)it->first.size();
+			groups += &it->second;
+		}
+		for (hmap<hstr, Group>::const_iterator it = this->animators.begin(); it != this->animators.end(); ++it)
+		{
+			result += (int64_t)it->first.size();
+			groups += &it->second;
+		}
+		foreachc (const Group*, it, groups)
+		{
+			for (hmap<hstr, hstr>::const_iterator it2 = (*it)->properties.begin(); it2 != (*it)->properties.end(); ++it2)
+			{
+				result += (int64_t)(it2->first.size() + it2->second.size() + sizeof(hstr) * 2);
+			}
+		}
+		for (hmap<hstr, harray<PropertyValue> >::const_iterator it = this->_flattenedProperties.begin(); it != this->_flattenedProperties.end(); ++it)
+		{
+			result += (int64_t)(it->first.size() + it->second.size() * sizeof(PropertyValue));
+		}
+		return result;
+	}
+
 	hmap<hstr, hstr> Style::findProperties(chstr className)
 	{
 		hmap<hstr, hstr> result;
@@ -70,6 +119,22 @@ namespace aprilui
 		return result;
 	}
 
+	const harray<Style::PropertyValue>& Style::findFlattenedProperties(chstr className)
+	{
+		hmap<hstr, harray<PropertyValue> >::iterator it = this->_flattenedProperties.find(className);
+		if (it != this->_flattenedProperties.end())
+		{
+			return it->second;
+		}
+		harray<PropertyValue>& result = this->_flattenedProperties[className];
+		hmap<hstr, hstr> properties = this->findProperties(className);
+		foreach_m (hstr, it2, properties)
+		{
+			result += PropertyValue(it2->first, it2->second);
+		}
+		return result;
+	}
+
 	void Style::_inject(Style* other)
 	{
 		this->objectDefaults.properties.inject(other->objectDefaults.properties);
@@ -98,6 +163,7 @@ namespace aprilui
 		{
 			this->animators[*it] = other->animators[*it];
 		}
+		this->_invalidateCache();
 	}
 
 	Style* Style::_injected(Style* other)
@@ -107,4 +173,37 @@ namespace aprilui
 		return result;
 	}
 
+	Style* Style::_findInjected(Style* other)
+	{
+		hmap<Style*, std::pair<int, Style*> >::iterator it = this->_injectedStyles.find(other);
+		if (it != this->_injectedStyles.end())
+		{
+			if (it->second.first == other->_revision)
+			{
+				return it->second.second;
+			}
+			delete it->second.second;
+			this->_injectedStyles.removeKey(other);
+		}
+		Style* result = this->_injected(other);
+		this->_injectedStyles[other] = std::pair<int, Style*>(other->_revision, result);
+		return result;
+	}
+
+	void Style::_invalidateCache()
+	{
+		this->_revision = _makeRevision();
+		this->_flattenedProperties.clear();
+		this->_clearInjectedStyles();
+	}
+
+	void Style::_clearInjectedStyles()
+	{
+		for (hmap<Style*, std::pair<int, Style*> >::iterator it = this->_injectedStyles.begin(); it != this->_injectedStyles.end(); ++it)
+		{
+			delete it->second.second;
+		}
+		this->_injectedStyles.clear();
+	}
+
 }
@@ -16,8 +16,10 @@
 
 namespace aprilui
 {
-	void _registerTexture(Texture* texture);
+	int64_t _registerTexture(Texture* texture);
 	void _unregisterTexture(Texture* texture);
+	int64_t _makeTextureUsage();
+	void _updateTextureMemoryUsage(int64_t difference);
 
 	Texture::Texture(chstr name, chstr filename, april::Texture* texture, bool managed)
 	{
@@ -36,13 +38,24 @@ namespace aprilui
 		float factor = aprilui::findTextureExtensionScale(this->filename);
 		this->scale.set(factor, factor);
 		this->dataset = NULL;
-		this->unusedTime = 0.0f;
-		_registerTexture(this);
+		this->lastUsage = 0;
+		this->_readyForUpload = false;
+		this->_idleStartTime = 0.0;
+		this->_idleScheduled = false;
+		this->_loadPending = false;
+		this->_byteSize = 0;
+		this->handle = _registerTexture(this);
+		this->_updateByteSize();
 	}
 
 	Texture::~Texture()
 	{
+		_updateTextureMemoryUsage(-this->_byteSize);
 		_unregisterTexture(this);
+		if (this->dataset != NULL)
+		{
+			this->dataset->_unscheduleTexture(this);
+		}
 		if (this->texture != NULL)
 		{
 			april::rendersys->destroyTexture(this->texture);
@@ -64,6 +77,12 @@ namespace aprilui
 			float factor = aprilui::findTextureExtensionScale(this->filename);
 			this->scale.set(factor, factor);
 		}
+		this->_updateByteSize();
+	}
+
+	float Texture::getUnusedTime() const
+	{
+		return (this->dataset != NULL ? (float)(this->dataset->_textureTime - this->_idleStartTime) : 0.0f);
 	}
 
 	int Texture::getWidth() const
@@ -101,6 +120,11 @@ namespace aprilui
 		return (this->texture != NULL);
 	}
 
+	int64_t Texture::getByteSize() const
+	{
+		return (this->texture != NULL && !this->texture->isUnloaded() ? (int64_t)this->texture->getByteSize() : 0LL);
+	}
+
 	void Texture::setFilter(april::Texture::Filter value)
 	{
 		this->filter = value;
@@ -115,31 +139,69 @@ namespace aprilui
 
 	void Texture::update(float timeDelta)
 	{
-		if (this->managed && this->texture != NULL && !this->texture->isUnloaded())
+		if (this->dataset != NULL && this->texture != NULL)
 		{
-			float maxTime = aprilui::getTextureIdleUnloadTime();
-			this->unusedTime += timeDelta;
-			if (maxTime > 0.0f && unusedTime >= maxTime)
+			// data that finished loading asynchronously is uploaded and displayed on the next draw
+			bool readyForUpload = this->texture->isReadyForUpload();
+			if (readyForUpload && !this->_readyForUpload)
 			{
-				this->texture->unload();
-				if (this->dataset != NULL)
-				{
-					this->dataset->triggerEvent(Event::TextureUnloaded, this);
-				}
-				this->unusedTime = 0.0f; // safe guard if texture is reloaded externally at some point
+				this->dataset->requestRedraw();
 			}
+			else if (!readyForUpload && this->texture->isAsyncLoadQueued())
+			{
+				this->dataset->requestUpdate();
+			}
+			this->_readyForUpload = readyForUpload;
 		}
+		this->_updateByteSize();
 	}
 
 	void Texture::resetUnusedTime()
 	{
-		this->unusedTime = 0.0f;
+		this->_resetIdleTime();
 		foreach (Texture*, it, this->links)
 		{
-			(*it)->unusedTime = 0.0f;
+			(*it)->_resetIdleTime();
+		}
+	}
+
+	void Texture::_resetIdleTime()
+	{
+		if (this->dataset != NULL)
+		{
+			this->_idleStartTime = this->dataset->_textureTime;
+			if (this->managed && !this->_idleScheduled && this->dataset->_textureIdleUnloadTime > 0.0f)
+			{
+				this->dataset->_scheduleTextureIdleDeadline(this);
+			}
+		}
+	}
+
+	void Texture::_updateByteSize()
+	{
+		int64_t byteSize = this->getByteSize();
+		if (this->_byteSize != byteSize)
+		{
+			_updateTextureMemoryUsage(byteSize - this->_byteSize);
+			this->_byteSize = byteSize;
+		}
+	}
+
+	void Texture::_markLoadPending()
+	{
+		if (this->dataset != NULL && !this->_loadPending && this->texture != NULL && !this->texture->isUploaded())
+		{
+			this->_loadPending = true;
+			this->dataset->_loadingTextures += this;
+			this->dataset->requestUpdate();
 		}
 	}
 	
+	void Texture::markUsed()
+	{
+		this->lastUsage = _makeTextureUsage();
+	}
+
 	bool Texture::loadMetaData(bool ignoreDynamicLinks)
 	{
 		bool result = this->texture->loadMetaData();
@@ -156,16 +218,19 @@ namespace aprilui
 	bool Texture::load(bool ignoreDynamicLinks)
 	{
 		bool result = true;
-		this->unusedTime = 0.0f;
 		if (!this->isUploaded())
 		{
 			bool unloaded = this->texture->isUnloaded();
 			result = this->texture->loadAsync();
+			if (result)
+			{
+				this->_markLoadPending();
+			}
 			if (unloaded && result)
 			{
 				if (this->dataset != NULL)
 				{
-					this->dataset->triggerEvent(Event::TextureLoaded, this);
+					this->dataset->triggerEvent(Event::TextureLoadedId, this);
 				}
 			}
 		}
@@ -173,35 +238,39 @@ namespace aprilui
 		{
 			foreach (Texture*, it, this->links)
 			{
-				(*it)->unusedTime = 0.0f;
+				(*it)->_resetIdleTime();
 				if ((*it)->isUnloaded())
 				{
 					// using loadAsync() here on purpose as the linked textures are probably not required right now so they can be loaded asynchronously
 					if ((*it)->texture->loadAsync())
 					{
+						(*it)->_markLoadPending();
+						(*it)->_updateByteSize();
 						if (this->dataset != NULL)
 						{
-							this->dataset->triggerEvent(Event::TextureLoaded, (*it));
+							this->dataset->triggerEvent(Event::TextureLoadedId, (*it));
 						}
 					}
 				}
 			}
 		}
+		this->_resetIdleTime();
+		this->_updateByteSize();
 		return result;
 	}
 
 	bool Texture::loadAsync(bool ignoreDynamicLinks)
 	{
 		bool result = false;
-		this->unusedTime = 0.0f;
 		if (this->isUnloaded())
 		{
 			result = this->texture->loadAsync();
 			if (result)
 			{
+				this->_markLoadPending();
 				if (this->dataset != NULL)
 				{
-					this->dataset->triggerEvent(Event::TextureLoaded, this);
+					this->dataset->triggerEvent(Event::TextureLoadedId, this);
 				}
 			}
 		}
@@ -209,19 +278,23 @@ namespace aprilui
 		{
 			foreach (Texture*, it, this->links)
 			{
-				(*it)->unusedTime = 0.0f;
+				(*it)->_resetIdleTime();
 				if ((*it)->isUnloaded())
 				{
 					if ((*it)->texture->loadAsync())
 					{
+						(*it)->_markLoadPending();
+						(*it)->_updateByteSize();
 						if (this->dataset != NULL)
 						{
-							this->dataset->triggerEvent(Event::TextureLoaded, (*it));
+							this->dataset->triggerEvent(Event::TextureLoadedId, (*it));
 						}
 					}
 				}
 			}
 		}
+		this->_resetIdleTime();
+		this->_updateByteSize();
 		return result;
 	}
 
@@ -231,11 +304,12 @@ namespace aprilui
 		{
 			bool previouslyUnloaded = this->texture->isUnloaded();
 			this->texture->unload();
+			this->_updateByteSize();
 			if (!previouslyUnloaded)
 			{
 				if (this->dataset != NULL)
 				{
-					this->dataset->triggerEvent(Event::TextureUnloaded, this);
+					this->dataset->triggerEvent(Event::TextureUnloadedId, this);
 				}
 			}
 		}
@@ -250,7 +324,8 @@ namespace aprilui
 				april::rendersys->destroyTexture(this->texture);
 			}
 			this->texture = NULL;
-			this->unusedTime = 0.0f;
+			this->_updateByteSize();
+			this->_resetIdleTime();
 			april::Texture* texture = april::rendersys->createTextureFromResource(filename, april::Texture::Type::Immutable, this->loadMode);
 			if (texture == NULL)
 			{
@@ -215,10 +215,11 @@ namespace aprilui
 			this->delay -= this->timeDelta;
 			if (this->delay > 0.0f)
 			{
+				this->_requestUpdate();
 				return;
 			}
-			this->notifyEvent(Event::AnimationDelayExpired, NULL);
-			this->triggerEvent(Event::AnimationDelayExpired);
+			this->notifyEvent(Event::AnimationDelayExpiredId, NULL);
+			this->triggerEvent(Event::AnimationDelayExpiredId);
 			this->timeDelta = -this->delay;
 		}
 		bool expired = this->isExpired();
@@ -227,10 +228,19 @@ namespace aprilui
 		{
 			this->speed = hmax(this->speed + this->acceleration * this->timeDelta, 0.0f);
 		}
-		if (!expired && this->isExpired())
+		if (!expired)
 		{
-			this->notifyEvent(Event::AnimationExpired, NULL);
-			this->triggerEvent(Event::AnimationExpired);
+			// the animated value could have changed even if it expired during this update
+			this->_requestRedraw();
+			if (this->isExpired())
+			{
+				this->notifyEvent(Event::AnimationExpiredId, NULL);
+				this->triggerEvent(Event::AnimationExpiredId);
+			}
+			else
+			{
+				this->_requestUpdate();
+			}
 		}
 	}
 
@@ -373,6 +383,11 @@ namespace aprilui
 		this->timer = 0.0;
 		this->update(0.0f);
 	}
+
+	int64_t Animator::getByteSize() const
+	{
+		return (BaseObject::getByteSize() + (int64_t)(sizeof(Animator) - sizeof(BaseObject)));
+	}
 	
 	hstr Animator::getProperty(chstr name)
 	{
@@ -437,18 +452,21 @@ namespace aprilui
 		return BaseObject::setProperty(name, value);
 	}
 	
-	void Animator::notifyEvent(chstr type, EventArgs* args)
+	void Animator::_notifyEvent(int typeId, EventArgs* args)
 	{
-		if (this->applyValuesOnAttach && (type == Event::AttachedToObject || type == Event::AnimationDelayExpired && this->inheritValue))
+		if (this->applyValuesOnAttach)
 		{
-			this->applyValuesOnAttach = false;
-			this->value = this->offset = this->_getObjectValue();
-			if (this->useTarget)
+			if (typeId == Event::AttachedToObjectId || typeId == Event::AnimationDelayExpiredId && this->inheritValue)
 			{
-				this->amplitude = this->target - this->value;
+				this->applyValuesOnAttach = false;
+				this->value = this->offset = this->_getObjectValue();
+				if (this->useTarget)
+				{
+					this->amplitude = this->target - this->value;
+				}
 			}
 		}
-		BaseObject::notifyEvent(type, args);
+		BaseObject::_notifyEvent(typeId, args);
 	}
 
 	void Animator::_valueUpdateSimple(float timeDelta)
@@ -72,6 +72,7 @@ namespace aprilui
 			if (FrameAnimation::_setters.size() == 0)
 			{
 				FrameAnimation::_setters = Animator::_getSetters();
+				FrameAnimation::_setters.removeKey("inherit_value"); // not supported, also prevents direct access through property IDs
 				FrameAnimation::_setters["base_name"] = new PropertyDescription::Set<FrameAnimation, hstr>(&FrameAnimation::setImageBaseName);
 				FrameAnimation::_setters["first_frame"] = new PropertyDescription::Set<FrameAnimation, int>(&FrameAnimation::setFirstFrame);
 				FrameAnimation::_setters["frame_count"] = new PropertyDescription::Set<FrameAnimation, int>(&FrameAnimation::setFrameCount);
@@ -94,9 +95,9 @@ namespace aprilui
 			return Animator::setProperty(name, value);
 		}
 
-		void FrameAnimation::notifyEvent(chstr type, EventArgs* args)
+		void FrameAnimation::_notifyEvent(int typeId, EventArgs* args)
 		{
-			if (type == Event::AttachedToObject && this->applyValuesOnAttach)
+			if (this->applyValuesOnAttach && typeId == Event::AttachedToObjectId)
 			{
 				this->value = (float)this->firstFrame;
 				float delay = this->delay;
@@ -104,7 +105,7 @@ namespace aprilui
 				this->update(0.0f);
 				this->delay = delay;
 			}
-			Animator::notifyEvent(type, args);
+			Animator::_notifyEvent(typeId, args);
 		}
 
 		void FrameAnimation::_update(float timeDelta)
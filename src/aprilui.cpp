@@ -41,8 +41,20 @@ namespace aprilui
 
 	bool _datasetRegisterLock = false; // not static, because it is used elsewhere
 	static hmap<hstr, Dataset*> datasets;
+	static hmap<int, Dataset*> datasetsByNameId;
+	// global name table, ID 0 is reserved for names that were never interned
+	static harray<hstr> internedNames;
+	static harray<int> internedNameDatasetIds; // ID of the part before the first '.' or 0 if there is none
+	static harray<int> internedNameLocalIds; // ID of the part after the first '.' or 0 if there is none
+	static hmap<hstr, int> nameIds;
+	static hmutex internedNamesMutex;
 	static Dataset* colorDataset = NULL;
-	static harray<Texture*> textures;
+	// slot map of all textures, handles stay valid until the texture is destroyed and are never reused for another texture
+	static harray<Texture*> textures; // dense, unordered
+	static harray<int> textureSlotIndices; // slot of each dense entry
+	static harray<int> textureSlots; // dense index of each slot or -1 if the slot is free
+	static harray<int> textureSlotGenerations;
+	static harray<int> freeTextureSlots;
 	static hmutex texturesMutex;
 	static hmap<hstr, Object* (*)(chstr)> objectFactories;
 	static hmap<hstr, Animator* (*)(chstr)> animatorFactories;
@@ -60,6 +72,20 @@ namespace aprilui
 	static hstr localization = "";
 	static harray<hstr> supportedLocalizations;
 	static float textureIdleUnloadTime = 0.0f;
+	static int64_t textureMemoryBudget = 0;
+	static int64_t textureUsageCounter = 0;
+	static int64_t textureMemoryUsage = 0; // maintained by the textures whenever they are loaded or unloaded
+	static int64_t textureUsageCheckpoint = 0; // textures used after this were used since the last budget check
+	static int64_t texturePrefetchBudget = 0;
+	static int64_t textureUploadBudget = 0;
+	static int64_t textureUploadFrameSize = 0;
+	static int64_t textureUploadReservedSize = 0; // budget kept for waiting textures that weren't uploaded yet in the current frame
+	static harray<Texture*> textureUploadQueue; // textures that were already waiting in previous frames
+	static hmap<Texture*, int64_t> textureUploadReservations;
+	static harray<Texture*> textureUploadRequests; // textures that were deferred in the current frame
+	static Texture* textureUploadPlaceholder = NULL;
+	static int textureAtlasPageSize = 0;
+	static int textureAtlasMaxTextureSize = 256;
 	static bool defaultManagedTextures = false;
 	static april::Texture::LoadMode defaultTextureLoadMode = april::Texture::LoadMode::Async;
 	static bool useKeyboardAutoOffset = false;
@@ -67,6 +93,61 @@ namespace aprilui
 
 	static const gvec2f _unusedTouchPosition(-10000.0f, -10000.0f);
 
+	// a queued input event, only the members used by its type are set
+	class QueuedInput
+	{
+	public:
+		enum Type
+		{
+			MouseDown,
+			MouseUp,
+			MouseCancel,
+			MouseMove,
+			MouseScroll,
+			KeyDown,
+			KeyUp,
+			Char,
+			TouchDown,
+			TouchUp,
+			TouchCancel,
+			TouchMove,
+			Touch,
+			ButtonDown,
+			ButtonUp
+		};
+
+		Type type;
+		april::Key keyCode;
+		april::Button buttonCode;
+		unsigned int charCode;
+		int index;
+		gvec2f position;
+		harray<gvec2f> touches;
+
+		QueuedInput(Type type) : type(type), keyCode(april::Key::None), buttonCode(april::Button::None), charCode(0), index(0)
+		{
+		}
+
+	};
+
+	static bool inputQueueEnabled = false;
+	static harray<QueuedInput> inputQueue;
+
+	// immutable copy of the texture registry that is shared by all readers until the registry changes
+	class TexturesSnapshot
+	{
+	public:
+		harray<Texture*> textures;
+		int references;
+
+		TexturesSnapshot(const harray<Texture*>& textures) : textures(textures), references(1)
+		{
+		}
+
+	};
+
+	static TexturesSnapshot* texturesSnapshot = NULL; // the registry's reference, NULL until requested after the registry changed
+
 	void init()
 	{
 		hlog::write(logTag, "Initializing AprilUI: " + version.toString());
@@ -78,6 +159,19 @@ namespace aprilui
 		defaultTextsPath = "texts";
 		localization = "";
 		textureIdleUnloadTime = 0.0f;
+		textureMemoryBudget = 0;
+		textureUsageCounter = 0;
+		textureUsageCheckpoint = 0;
+		texturePrefetchBudget = 0;
+		textureUploadBudget = 0;
+		textureUploadFrameSize = 0;
+		textureUploadReservedSize = 0;
+		textureUploadQueue.clear();
+		textureUploadReservations.clear();
+		textureUploadRequests.clear();
+		textureUploadPlaceholder = NULL;
+		textureAtlasPageSize = 0;
+		textureAtlasMaxTextureSize = 256;
 		defaultManagedTextures = false;
 		defaultTextureLoadMode = april::Texture::LoadMode::Async;
 		viewport.setSize(april::window->getSize());
@@ -153,11 +247,13 @@ namespace aprilui
 			delete it->second;
 		}
 		datasets.clear();
+		datasetsByNameId.clear();
 		colorDataset = NULL;
 		objectFactories.clear();
 		animatorFactories.clear();
 		imageFactories.clear();
 		cursorImage = NULL;
+		inputQueue.clear();
 	}
 	
 	bool isDebugEnabled()
@@ -253,7 +349,7 @@ namespace aprilui
 			{
 				if (it->second->isLoaded())
 				{
-					it->second->notifyEvent(Event::LocalizationChanged, NULL);
+					it->second->notifyEvent(Event::LocalizationChangedId, NULL);
 				}
 			}
 		}
@@ -279,6 +375,121 @@ namespace aprilui
 		textureIdleUnloadTime = value;
 	}
 
+	int64_t getTextureMemoryBudget()
+	{
+		return textureMemoryBudget;
+	}
+
+	void setTextureMemoryBudget(int64_t value)
+	{
+		textureMemoryBudget = hmax(value, (int64_t)0);
+	}
+
+	// iterating over the snapshot does not require holding the lock, call _releaseTexturesSnapshot() when done
+	static TexturesSnapshot* _acquireTexturesSnapshot()
+	{
+		hmutex::ScopeLock lock(&texturesMutex);
+		if (texturesSnapshot == NULL)
+		{
+			texturesSnapshot = new TexturesSnapshot(textures);
+		}
+		++texturesSnapshot->references;
+		return texturesSnapshot;
+	}
+
+	// has to be called while texturesMutex is locked
+	static void _dereferenceTexturesSnapshot(TexturesSnapshot* snapshot)
+	{
+		--snapshot->references;
+		if (snapshot->references == 0)
+		{
+			delete snapshot;
+		}
+	}
+
+	static void _releaseTexturesSnapshot(TexturesSnapshot* snapshot)
+	{
+		hmutex::ScopeLock lock(&texturesMutex);
+		_dereferenceTexturesSnapshot(snapshot);
+	}
+
+	// has to be called while texturesMutex is locked
+	static void _invalidateTexturesSnapshot()
+	{
+		if (texturesSnapshot != NULL)
+		{
+			_dereferenceTexturesSnapshot(texturesSnapshot);
+			texturesSnapshot = NULL;
+		}
+	}
+
+	int64_t getTextureMemoryUsage()
+	{
+		hmutex::ScopeLock lock(&texturesMutex);
+		return textureMemoryUsage;
+	}
+
+	void _updateTextureMemoryUsage(int64_t difference)
+	{
+		hmutex::ScopeLock lock(&texturesMutex);
+		textureMemoryUsage += difference;
+	}
+
+	int64_t getTexturePrefetchBudget()
+	{
+		return texturePrefetchBudget;
+	}
+
+	void setTexturePrefetchBudget(int64_t value)
+	{
+		texturePrefetchBudget = hmax(value, (int64_t)0);
+	}
+
+	int64_t getTextureUploadBudget()
+	{
+		return textureUploadBudget;
+	}
+
+	void setTextureUploadBudget(int64_t value)
+	{
+		textureUploadBudget = hmax(value, (int64_t)0);
+	}
+
+	Texture* getTextureUploadPlaceholder()
+	{
+		return textureUploadPlaceholder;
+	}
+
+	void setTextureUploadPlaceholder(Texture* value)
+	{
+		textureUploadPlaceholder = value;
+	}
+
+	int getPendingTextureUploadCount()
+	{
+		return textureUploadQueue.size();
+	}
+
+	int getTextureAtlasPageSize()
+	{
+		return textureAtlasPageSize;
+	}
+
+	void setTextureAtlasPageSize(int value)
+	{
+		textureAtlasPageSize = hmax(value, 0);
+	}
+
+	int getTextureAtlasMaxTextureSize()
+	{
+		return textureAtlasMaxTextureSize;
+	}
+
+	void setTextureAtlasMaxTextureSize(int value)
+	{
+		textureAtlasMaxTextureSize = hmax(value, 1);
+	}
+
 	bool isDefaultManagedTextures()
 	{
 		return defaultManagedTextures;
@@ -316,8 +527,22 @@ namespace aprilui
 
 	harray<Texture*> getTextures()
 	{
+		TexturesSnapshot* snapshot = _acquireTexturesSnapshot();
+		harray<Texture*> result = snapshot->textures;
+		_releaseTexturesSnapshot(snapshot);
+		return result;
+	}
+
+	Texture* getTextureByHandle(int64_t handle)
+	{
+		int slot = (int)(handle & 0xFFFFFFFF);
+		int generation = (int)(handle >> 32);
 		hmutex::ScopeLock lock(&texturesMutex);
-		return textures;
+		if (slot < 0 || slot >= textureSlots.size() || textureSlots[slot] < 0 || textureSlotGenerations[slot] != generation)
+		{
+			return NULL;
+		}
+		return textures[textureSlots[slot]];
 	}
 	
 	void registerObjectFactory(chstr typeName, Object* (*factory)(chstr))
@@ -646,6 +871,69 @@ namespace aprilui
 		return datasets[name];
 	}
 	
+	Dataset* _getDatasetByNameId(int nameId)
+	{
+		return datasetsByNameId.tryGet(nameId, NULL);
+	}
+
+	static int _internName(chstr name)
+	{
+		if (internedNames.size() == 0)
+		{
+			internedNames += hstr();
+			internedNameDatasetIds += 0;
+			internedNameLocalIds += 0;
+		}
+		int nameId = nameIds.tryGet(name, 0);
+		if (nameId == 0)
+		{
+			int datasetNameId = 0;
+			int localNameId = 0;
+			int dot = name.indexOf('.');
+			if (dot >= 0)
+			{
+				datasetNameId = _internName(name(0, dot));
+				localNameId = _internName(name(dot + 1, -1));
+			}
+			nameId = internedNames.size();
+			internedNames += name;
+			internedNameDatasetIds += datasetNameId;
+			internedNameLocalIds += localNameId;
+			nameIds[name] = nameId;
+		}
+		return nameId;
+	}
+
+	int internName(chstr name)
+	{
+		hmutex::ScopeLock lock(&internedNamesMutex);
+		return _internName(name);
+	}
+
+	int findNameId(chstr name)
+	{
+		hmutex::ScopeLock lock(&internedNamesMutex);
+		return nameIds.tryGet(name, 0);
+	}
+
+	hstr getInternedName(int nameId)
+	{
+		hmutex::ScopeLock lock(&internedNamesMutex);
+		return (nameId > 0 && nameId < internedNames.size() ? internedNames[nameId] : hstr(""));
+	}
+
+	bool _getInternedNameParts(int nameId, int& datasetNameId, int& localNameId)
+	{
+		hmutex::ScopeLock lock(&internedNamesMutex);
+		if (nameId <= 0 || nameId >= internedNames.size() || internedNameDatasetIds[nameId] == 0)
+		{
+			return false;
+		}
+		datasetNameId = internedNameDatasetIds[nameId];
+		localNameId = internedNameLocalIds[nameId];
+		return true;
+	}
+
 	void _registerDataset(chstr name, Dataset* dataset)
 	{
 		if (!_datasetRegisterLock)
@@ -655,6 +943,7 @@ namespace aprilui
 				__THROW_EXCEPTION(ObjectExistsException("Dataset", name, name), aprilui::objectExistenceDebugExceptionsEnabled, return);
 			}
 			datasets[name] = dataset;
+			datasetsByNameId[aprilui::internName(name)] = dataset;
 		}
 	}
 	
@@ -663,26 +952,155 @@ namespace aprilui
 		if (!_datasetRegisterLock)
 		{
 			datasets.removeKey(name);
+			datasetsByNameId.removeKey(aprilui::internName(name));
 		}
 	}
 	
-	void _registerTexture(Texture* texture)
+	int64_t _registerTexture(Texture* texture)
 	{
 		hmutex::ScopeLock lock(&texturesMutex);
+		int slot = 0;
+		if (freeTextureSlots.size() > 0)
+		{
+			slot = freeTextureSlots.removeLast();
+		}
+		else
+		{
+			slot = textureSlots.size();
+			textureSlots += -1;
+			textureSlotGenerations += 1; // starting with 1 so 0 is never a valid handle
+		}
+		textureSlots[slot] = textures.size();
 		textures += texture;
+		textureSlotIndices += slot;
+		_invalidateTexturesSnapshot();
+		return (((int64_t)textureSlotGenerations[slot] << 32) | (int64_t)slot);
 	}
 
 	void _unregisterTexture(Texture* texture)
 	{
-		hmutex::ScopeLock lock(&texturesMutex);
-		textures -= texture;
+		{
+			hmutex::ScopeLock lock(&texturesMutex);
+			int slot = (int)(texture->getHandle() & 0xFFFFFFFF);
+			int index = textureSlots[slot];
+			int last = textures.size() - 1;
+			// the last entry fills the gap so nothing has to be searched or shifted
+			if (index != last)
+			{
+				textures[index] = textures[last];
+				textureSlotIndices[index] = textureSlotIndices[last];
+				textureSlots[textureSlotIndices[index]] = index;
+			}
+			textures.removeLast();
+			textureSlotIndices.removeLast();
+			textureSlots[slot] = -1;
+			++textureSlotGenerations[slot];
+			freeTextureSlots += slot;
+			_invalidateTexturesSnapshot();
+		}
+		textureUploadQueue.removeAll(texture);
+		if (textureUploadReservations.hasKey(texture))
+		{
+			textureUploadReservedSize -= textureUploadReservations[texture];
+			textureUploadReservations.removeKey(texture);
+		}
+		textureUploadRequests.removeAll(texture);
+		if (textureUploadPlaceholder == texture)
+		{
+			textureUploadPlaceholder = NULL;
+		}
+	}
+
+	bool _tryUploadTexture(Texture* texture)
+	{
+		if (textureUploadBudget <= 0 || texture->isUploaded() || texture == textureUploadPlaceholder)
+		{
+			return true;
+		}
+		// only textures with data available are uploaded when drawn, others are still loading asynchronously
+		if (!texture->isReadyForUpload() && texture->getLoadMode() != april::Texture::LoadMode::OnDemand)
+		{
+			return true;
+		}
+		int64_t size = (int64_t)texture->getTexture()->getWidth() * texture->getTexture()->getHeight() * 4;
+		bool waiting = textureUploadQueue.has(texture);
+		if (waiting)
+		{
+			// the reservation was made for this texture so only the budget itself can hold it back
+			if (textureUploadFrameSize == 0 || textureUploadFrameSize + size <= textureUploadBudget)
+			{
+				textureUploadFrameSize += size;
+				textureUploadQueue -= texture;
+				if (textureUploadReservations.hasKey(texture))
+				{
+					textureUploadReservedSize -= textureUploadReservations[texture];
+					textureUploadReservations.removeKey(texture);
+				}
+				return true;
+			}
+		}
+		// new textures only get what is left after the waiting textures so they can't starve them
+		else if ((textureUploadFrameSize == 0 && textureUploadReservedSize == 0) || textureUploadFrameSize + textureUploadReservedSize + size <= textureUploadBudget)
+		{
+			textureUploadFrameSize += size;
+			return true;
+		}
+		if (!textureUploadRequests.has(texture))
+		{
+			textureUploadRequests += texture;
+		}
+		if (texture->getDataset() != NULL)
+		{
+			texture->getDataset()->requestRedraw();
+		}
+		return false;
+	}
+
+	static void _updateTextureUploads()
+	{
+		// textures that were not drawn during the last frame are not visible anymore so they are dropped
+		harray<Texture*> queue;
+		foreach (Texture*, it, textureUploadQueue)
+		{
+			if (textureUploadRequests.has(*it))
+			{
+				queue += (*it);
+			}
+		}
+		foreach (Texture*, it, textureUploadRequests)
+		{
+			if (!queue.has(*it))
+			{
+				queue += (*it);
+			}
+		}
+		textureUploadQueue = queue;
+		textureUploadRequests.clear();
+		textureUploadFrameSize = 0;
+		// waiting textures reserve their part of the next frame's budget before any new textures are considered
+		textureUploadReservations.clear();
+		textureUploadReservedSize = 0;
+		int64_t size = 0;
+		foreach (Texture*, it, textureUploadQueue)
+		{
+			size = (int64_t)(*it)->getTexture()->getWidth() * (*it)->getTexture()->getHeight() * 4;
+			textureUploadReservations[*it] = size;
+			textureUploadReservedSize += size;
+		}
+	}
+
+	int64_t _makeTextureUsage()
+	{
+		++textureUsageCounter;
+		return textureUsageCounter;
 	}
 
 	void notifyEvent(chstr type, EventArgs* args)
 	{
+		int typeId = Event::getTypeId(type);
 		foreach_m (Dataset*, it, datasets)
 		{
-			it->second->notifyEvent(type, args);
+			it->second->notifyEvent(typeId, args);
 		}
 	}
 
@@ -696,6 +1114,7 @@ namespace aprilui
 
 	void update(float timeDelta)
 	{
+		aprilui::processInput();
 		foreach_m (Dataset*, it, datasets)
 		{
 			it->second->update(timeDelta);
@@ -708,6 +1127,53 @@ namespace aprilui
 		{
 			it->second->updateTextures(timeDelta);
 		}
+		enforceTextureMemoryBudget();
+		_updateTextureUploads();
+	}
+
+	void enforceTextureMemoryBudget()
+	{
+		// the textures are only checked when the running total exceeds the budget
+		if (textureMemoryBudget <= 0 || getTextureMemoryUsage() <= textureMemoryBudget)
+		{
+			textureUsageCheckpoint = textureUsageCounter;
+			return;
+		}
+		int64_t usage = 0;
+		int64_t size = 0;
+		harray<Texture*> candidates;
+		TexturesSnapshot* snapshot = _acquireTexturesSnapshot();
+		foreach (Texture*, it, snapshot->textures)
+		{
+			size = (*it)->getByteSize();
+			if (size > 0)
+			{
+				usage += size;
+				if ((*it)->isManaged() && (*it)->getLastUsage() <= textureUsageCheckpoint)
+				{
+					candidates += (*it);
+				}
+			}
+		}
+		_releaseTexturesSnapshot(snapshot);
+		if (usage > textureMemoryBudget && candidates.size() > 0)
+		{
+			HL_LAMBDA_CLASS(_sortTextures, bool, ((Texture* const& a, Texture* const& b) { return (a->getLastUsage() < b->getLastUsage()); }));
+			candidates.sort(&_sortTextures::lambda);
+			int count = 0;
+			foreach (Texture*, it, candidates)
+			{
+				if (usage <= textureMemoryBudget)
+				{
+					break;
+				}
+				usage -= (*it)->getByteSize();
+				(*it)->unload();
+				++count;
+			}
+			hlog::debugf(logTag, "Texture memory budget exceeded, unloaded %d least recently used textures.", count);
+		}
+		textureUsageCheckpoint = textureUsageCounter;
 	}
 	
 	void clearChildUnderCursor()
@@ -811,43 +1277,97 @@ namespace aprilui
 		return 1.0f;
 	}
 
-	void onMouseDown(april::Key keyCode)
+	bool isInputQueueEnabled()
+	{
+		return inputQueueEnabled;
+	}
+
+	void setInputQueueEnabled(bool value)
+	{
+		if (inputQueueEnabled != value)
+		{
+			// nothing that was already received should get lost or wait for the next frame
+			aprilui::processInput();
+			inputQueueEnabled = value;
+		}
+	}
+
+	static void _queueInput(const QueuedInput& input)
+	{
+		// hosts that skip update() while datasets are idle still have to call it so the queue is processed
+		foreach_m (Dataset*, it, datasets)
+		{
+			it->second->requestUpdate();
+		}
+		if (input.type == QueuedInput::MouseMove || input.type == QueuedInput::TouchMove)
+		{
+			// a move only replaces an earlier move of the same pointer if no other kind of event came in between
+			for_iter_r (i, inputQueue.size(), 0)
+			{
+				QueuedInput& queued = inputQueue[i];
+				if (queued.type != QueuedInput::MouseMove && queued.type != QueuedInput::TouchMove)
+				{
+					break;
+				}
+				if (queued.type == input.type && queued.index == input.index)
+				{
+					queued.position = input.position;
+					return;
+				}
+			}
+		}
+		inputQueue += input;
+	}
+
+	static void _queueMouseInput(QueuedInput::Type type, april::Key keyCode)
+	{
+		QueuedInput input(type);
+		input.keyCode = keyCode;
+		input.position = cursorPosition;
+		_queueInput(input);
+	}
+
+	static void _queueTouchInput(QueuedInput::Type type, int index)
+	{
+		QueuedInput input(type);
+		input.index = index;
+		input.position = touchPositions[index];
+		_queueInput(input);
+	}
+
+	static void _dispatchMouseDown(april::Key keyCode)
 	{
-		aprilui::updateCursorPosition();
 		foreach_m (Dataset*, it, datasets)
 		{
 			it->second->onMouseDown(keyCode);
 		}
 	}
 	
-	void onMouseUp(april::Key keyCode)
+	static void _dispatchMouseUp(april::Key keyCode)
 	{
-		aprilui::updateCursorPosition();
 		foreach_m (Dataset*, it, datasets)
 		{
 			it->second->onMouseUp(keyCode);
 		}
 	}
 	
-	void onMouseCancel(april::Key keyCode)
+	static void _dispatchMouseCancel(april::Key keyCode)
 	{
-		aprilui::updateCursorPosition();
 		foreach_m (Dataset*, it, datasets)
 		{
 			it->second->onMouseCancel(keyCode);
 		}
 	}
 	
-	void onMouseMove()
+	static void _dispatchMouseMove()
 	{
-		aprilui::updateCursorPosition();
 		foreach_m (Dataset*, it, datasets)
 		{
 			it->second->onMouseMove();
 		}
 	}
 	
-	void onMouseScroll(float x, float y)
+	static void _dispatchMouseScroll(float x, float y)
 	{
 		foreach_m (Dataset*, it, datasets)
 		{
@@ -855,7 +1375,7 @@ namespace aprilui
 		}
 	}
 	
-	void onKeyDown(april::Key keyCode)
+	static void _dispatchKeyDown(april::Key keyCode)
 	{
 		foreach_m (Dataset*, it, datasets)
 		{
@@ -863,7 +1383,7 @@ namespace aprilui
 		}
 	}
 	
-	void onKeyUp(april::Key keyCode)
+	static void _dispatchKeyUp(april::Key keyCode)
 	{
 		foreach_m (Dataset*, it, datasets)
 		{
@@ -871,7 +1391,7 @@ namespace aprilui
 		}
 	}
 	
-	void onChar(unsigned int charCode)
+	static void _dispatchChar(unsigned int charCode)
 	{
 		foreach_m (Dataset*, it, datasets)
 		{
@@ -879,43 +1399,75 @@ namespace aprilui
 		}
 	}
 	
-	void onTouchDown(int index)
+	// a captured touch belongs only to the dataset of the capturing object
+	static Dataset* _getTouchCaptureDataset(int index)
 	{
-		aprilui::updateTouchPosition(index);
+		foreach_m (Dataset*, it, datasets)
+		{
+			if (it->second->getTouchCapture(index) != NULL)
+			{
+				return it->second;
+			}
+		}
+		return NULL;
+	}
+
+	static void _dispatchTouchDown(int index)
+	{
+		// a new touch with the same index cannot belong to an old capture anymore
+		foreach_m (Dataset*, it, datasets)
+		{
+			it->second->releaseTouch(index);
+		}
 		foreach_m (Dataset*, it, datasets)
 		{
 			it->second->onTouchDown(index);
 		}
 	}
 	
-	void onTouchUp(int index)
+	static void _dispatchTouchUp(int index)
 	{
-		aprilui::updateTouchPosition(index);
+		Dataset* dataset = _getTouchCaptureDataset(index);
+		if (dataset != NULL)
+		{
+			dataset->onTouchUp(index);
+			return;
+		}
 		foreach_m (Dataset*, it, datasets)
 		{
 			it->second->onTouchUp(index);
 		}
 	}
 	
-	void onTouchCancel(int index)
+	static void _dispatchTouchCancel(int index)
 	{
-		aprilui::updateTouchPosition(index);
+		Dataset* dataset = _getTouchCaptureDataset(index);
+		if (dataset != NULL)
+		{
+			dataset->onTouchCancel(index);
+			return;
+		}
 		foreach_m (Dataset*, it, datasets)
 		{
 			it->second->onTouchCancel(index);
 		}
 	}
 	
-	void onTouchMove(int index)
+	static void _dispatchTouchMove(int index)
 	{
-		aprilui::updateTouchPosition(index);
+		Dataset* dataset = _getTouchCaptureDataset(index);
+		if (dataset != NULL)
+		{
+			dataset->onTouchMove(index);
+			return;
+		}
 		foreach_m (Dataset*, it, datasets)
 		{
 			it->second->onTouchMove(index);
 		}
 	}
 	
-	void onTouch(const harray<gvec2f>& touches)
+	static void _dispatchTouch(const harray<gvec2f>& touches)
 	{
 		foreach_m (Dataset*, it, datasets)
 		{
@@ -923,7 +1475,7 @@ namespace aprilui
 		}
 	}
 	
-	void onButtonDown(april::Button buttonCode)
+	static void _dispatchButtonDown(april::Button buttonCode)
 	{
 		foreach_m (Dataset*, it, datasets)
 		{
@@ -931,7 +1483,7 @@ namespace aprilui
 		}
 	}
 	
-	void onButtonUp(april::Button buttonCode)
+	static void _dispatchButtonUp(april::Button buttonCode)
 	{
 		foreach_m (Dataset*, it, datasets)
 		{
@@ -939,4 +1491,246 @@ namespace aprilui
 		}
 	}
 	
+	void processInput()
+	{
+		if (inputQueue.size() == 0)
+		{
+			return;
+		}
+		// handlers may receive new input while the queue is being processed
+		harray<QueuedInput> queue = inputQueue;
+		inputQueue.clear();
+		foreach (QueuedInput, it, queue)
+		{
+			switch ((*it).type)
+			{
+			case QueuedInput::MouseDown:
+				cursorPosition = (*it).position;
+				_dispatchMouseDown((*it).keyCode);
+				break;
+			case QueuedInput::MouseUp:
+				cursorPosition = (*it).position;
+				_dispatchMouseUp((*it).keyCode);
+				break;
+			case QueuedInput::MouseCancel:
+				cursorPosition = (*it).position;
+				_dispatchMouseCancel((*it).keyCode);
+				break;
+			case QueuedInput::MouseMove:
+				cursorPosition = (*it).position;
+				_dispatchMouseMove();
+				break;
+			case QueuedInput::MouseScroll:
+				_dispatchMouseScroll((*it).position.x, (*it).position.y);
+				break;
+			case QueuedInput::KeyDown:
+				_dispatchKeyDown((*it).keyCode);
+				break;
+			case QueuedInput::KeyUp:
+				_dispatchKeyUp((*it).keyCode);
+				break;
+			case QueuedInput::Char:
+				_dispatchChar((*it).charCode);
+				break;
+			case QueuedInput::TouchDown:
+				touchPositions[(*it).index] = (*it).position;
+				_dispatchTouchDown((*it).index);
+				break;
+			case QueuedInput::TouchUp:
+				touchPositions[(*it).index] = (*it).position;
+				_dispatchTouchUp((*it).index);
+				break;
+			case QueuedInput::TouchCancel:
+				touchPositions[(*it).index] = (*it).position;
+				_dispatchTouchCancel((*it).index);
+				break;
+			case QueuedInput::TouchMove:
+				touchPositions[(*it).index] = (*it).position;
+				_dispatchTouchMove((*it).index);
+				break;
+			case QueuedInput::Touch:
+				_dispatchTouch((*it).touches);
+				break;
+			case QueuedInput::ButtonDown:
+				_dispatchButtonDown((*it).buttonCode);
+				break;
+			case QueuedInput::ButtonUp:
+				_dispatchButtonUp((*it).buttonCode);
+				break;
+			}
+		}
+	}
+
+	void onMouseDown(april::Key keyCode)
+	{
+		aprilui::updateCursorPosition();
+		if (inputQueueEnabled)
+		{
+			_queueMouseInput(QueuedInput::MouseDown, keyCode);
+			return;
+		}
+		_dispatchMouseDown(keyCode);
+	}
+	
+	void onMouseUp(april::Key keyCode)
+	{
+		aprilui::updateCursorPosition();
+		if (inputQueueEnabled)
+		{
+			_queueMouseInput(QueuedInput::MouseUp, keyCode);
+			return;
+		}
+		_dispatchMouseUp(keyCode);
+	}
+	
+	void onMouseCancel(april::Key keyCode)
+	{
+		aprilui::updateCursorPosition();
+		if (inputQueueEnabled)
+		{
+			_queueMouseInput(QueuedInput::MouseCancel, keyCode);
+			return;
+		}
+		_dispatchMouseCancel(keyCode);
+	}
+	
+	void onMouseMove()
+	{
+		aprilui::updateCursorPosition();
+		if (inputQueueEnabled)
+		{
+			_queueMouseInput(QueuedInput::MouseMove, april::Key::None);
+			return;
+		}
+		_dispatchMouseMove();
+	}
+	
+	void onMouseScroll(float x, float y)
+	{
+		if (inputQueueEnabled)
+		{
+			QueuedInput input(QueuedInput::MouseScroll);
+			input.position.set(x, y);
+			_queueInput(input);
+			return;
+		}
+		_dispatchMouseScroll(x, y);
+	}
+	
+	void onKeyDown(april::Key keyCode)
+	{
+		if (inputQueueEnabled)
+		{
+			QueuedInput input(QueuedInput::KeyDown);
+			input.keyCode = keyCode;
+			_queueInput(input);
+			return;
+		}
+		_dispatchKeyDown(keyCode);
+	}
+	
+	void onKeyUp(april::Key keyCode)
+	{
+		if (inputQueueEnabled)
+		{
+			QueuedInput input(QueuedInput::KeyUp);
+			input.keyCode = keyCode;
+			_queueInput(input);
+			return;
+		}
+		_dispatchKeyUp(keyCode);
+	}
+	
+	void onChar(unsigned int charCode)
+	{
+		if (inputQueueEnabled)
+		{
+			QueuedInput input(QueuedInput::Char);
+			input.charCode = charCode;
+			_queueInput(input);
+			return;
+		}
+		_dispatchChar(charCode);
+	}
+	
+	void onTouchDown(int index)
+	{
+		aprilui::updateTouchPosition(index);
+		if (inputQueueEnabled)
+		{
+			_queueTouchInput(QueuedInput::TouchDown, index);
+			return;
+		}
+		_dispatchTouchDown(index);
+	}
+	
+	void onTouchUp(int index)
+	{
+		aprilui::updateTouchPosition(index);
+		if (inputQueueEnabled)
+		{
+			_queueTouchInput(QueuedInput::TouchUp, index);
+			return;
+		}
+		_dispatchTouchUp(index);
+	}
+	
+	void onTouchCancel(int index)
+	{
+		aprilui::updateTouchPosition(index);
+		if (inputQueueEnabled)
+		{
+			_queueTouchInput(QueuedInput::TouchCancel, index);
+			return;
+		}
+		_dispatchTouchCancel(index);
+	}
+	
+	void onTouchMove(int index)
+	{
+		aprilui::updateTouchPosition(index);
+		if (inputQueueEnabled)
+		{
+			_queueTouchInput(QueuedInput::TouchMove, index);
+			return;
+		}
+		_dispatchTouchMove(index);
+	}
+	
+	void onTouch(const harray<gvec2f>& touches)
+	{
+		if (inputQueueEnabled)
+		{
+			QueuedInput input(QueuedInput::Touch);
+			input.touches = touches;
+			_queueInput(input);
+			return;
+		}
+		_dispatchTouch(touches);
+	}
+	
+	void onButtonDown(april::Button buttonCode)
+	{
+		if (inputQueueEnabled)
+		{
+			QueuedInput input(QueuedInput::ButtonDown);
+			input.buttonCode = buttonCode;
+			_queueInput(input);
+			return;
+		}
+		_dispatchButtonDown(buttonCode);
+	}
+	
+	void onButtonUp(april::Button buttonCode)
+	{
+		if (inputQueueEnabled)
+		{
+			QueuedInput input(QueuedInput::ButtonUp);
+			input.buttonCode = buttonCode;
+			_queueInput(input);
+			return;
+		}
+		_dispatchButtonUp(buttonCode);
+	}
+	
 }
@@ -106,6 +106,14 @@ namespace aprilui
 		this->name = value;
 	}
 
+	void BaseImage::drawClipped(cgrectf rect, cgrectf clipRect, const april::Color& color)
+	{
+		grectf oldClipRect = this->clipRect;
+		this->setClipRect(clipRect);
+		this->draw(rect, color);
+		this->setClipRect(oldClipRect);
+	}
+
 	void BaseImage::setClipRect(cgrectf value)
 	{
 		if (this->clipRect != value)
@@ -192,6 +200,16 @@ namespace aprilui
 		return (this->dataset != NULL ? this->dataset->getName() + "." + this->name : this->name);
 	}
 
+	int64_t BaseImage::getByteSize() const
+	{
+		return (int64_t)(sizeof(BaseImage) + this->name.size() + this->tag.size());
+	}
+
+	int64_t BaseImage::getCacheByteSize() const
+	{
+		return 0LL;
+	}
+
 	bool BaseImage::hasProperty(chstr name)
 	{
 		return this->getPropertyDescriptions().hasKey(name);
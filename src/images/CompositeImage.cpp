@@ -80,6 +80,11 @@ namespace aprilui
 	}
 	
 	void CompositeImage::draw(cgrectf rect, const april::Color& color)
+	{
+		this->drawClipped(rect, this->clipRect, color);
+	}
+
+	void CompositeImage::drawClipped(cgrectf rect, cgrectf clipRect, const april::Color& color)
 	{
 		if (color.a == 0)
 		{
@@ -88,7 +93,7 @@ namespace aprilui
 		gvec2f sf = rect.getSize() / this->size;
 		grectf drawRect;
 		// using separate loops for performance reasons
-		if (this->clipRect.w == 0.0f || this->clipRect.h == 0.0f)
+		if (clipRect.w == 0.0f || clipRect.h == 0.0f)
 		{
 			foreach (ImageRef, it, this->images)
 			{
@@ -99,24 +104,17 @@ namespace aprilui
 		else
 		{
 			gvec2f cf;
-			grectf oldClipRect;
-			grectf clipRect;
+			grectf imageClipRect;
 			foreach (ImageRef, it, this->images)
 			{
-				clipRect.set(0.0f, 0.0f, (*it).second.getSize());
-				clipRect.clip(this->clipRect - (*it).second.getPosition());
+				imageClipRect.set(0.0f, 0.0f, (*it).second.getSize());
+				imageClipRect.clip(clipRect - (*it).second.getPosition());
 				cf = (*it).first->getSrcSize() / (*it).second.getSize();
-				clipRect.set(clipRect.getPosition() * cf, clipRect.getSize() * cf);
-				if (clipRect.w > 0.0f && clipRect.h > 0.0f)
+				imageClipRect.set(imageClipRect.getPosition() * cf, imageClipRect.getSize() * cf);
+				if (imageClipRect.w > 0.0f && imageClipRect.h > 0.0f)
 				{
-					oldClipRect = (*it).first->getClipRect();
-					(*it).first->setClipRect(clipRect);
 					drawRect.set(rect.getPosition() + (*it).second.getPosition() * sf, (*it).second.getSize() * sf);
-					(*it).first->draw(drawRect, color);
-					if (this->restoreClipRects)
-					{
-						(*it).first->setClipRect(oldClipRect);
-					}
+					(*it).first->drawClipped(drawRect, imageClipRect, color);
 				}
 			}
 		}
@@ -93,6 +93,7 @@ namespace aprilui
 		{
 			this->realSrcSize = value;
 			this->_textureCoordinatesLoaded = false;
+			this->_clippedTextureCoordinates.clear();
 		}
 	}
 
@@ -102,6 +103,7 @@ namespace aprilui
 		{
 			this->realSrcSize.set(w, h);
 			this->_textureCoordinatesLoaded = false;
+			this->_clippedTextureCoordinates.clear();
 		}
 	}
 
@@ -111,6 +113,7 @@ namespace aprilui
 		{
 			this->realSrcSize.x = value;
 			this->_textureCoordinatesLoaded = false;
+			this->_clippedTextureCoordinates.clear();
 		}
 	}
 
@@ -120,6 +123,7 @@ namespace aprilui
 		{
 			this->realSrcSize.y = value;
 			this->_textureCoordinatesLoaded = false;
+			this->_clippedTextureCoordinates.clear();
 		}
 	}
 
@@ -128,47 +132,32 @@ namespace aprilui
 		return grectf(this->srcRect.getPosition(), this->realSrcSize);
 	}
 
-	grectf CropImage::_makeClippedSrcRect() const
+	grectf CropImage::_makeClippedSrcRect(cgrectf clipRect) const
 	{
-		if (this->clipRect.w > 0.0f && this->clipRect.h > 0.0f)
+		if (clipRect.w > 0.0f && clipRect.h > 0.0f)
 		{
 			grectf realSrcRect = this->_makeRealSrcRect();
-			return realSrcRect.clipped(this->clipRect - this->drawPosition + realSrcRect.getPosition());
+			return realSrcRect.clipped(clipRect - this->drawPosition + realSrcRect.getPosition());
 		}
 		return this->_makeRealSrcRect();
 	}
 
-	void CropImage::draw(cgrectf rect, const april::Color& color)
+	grectf CropImage::_makeClippedDrawRect(cgrectf rect, cgrectf clipRect) const
 	{
-		if (color.a == 0 || this->colorTopLeft.a == 0)
-		{
-			return;
-		}
-		april::Color drawColor = color;
-		if (this->colorTopLeft != april::Color::White)
-		{
-			drawColor *= this->colorTopLeft;
-			if (drawColor.a == 0)
-			{
-				return;
-			}
-		}
 		gvec2f sizeRatio = rect.getSize() / this->srcRect.getSize();
 		grectf drawRect(rect.getPosition() + this->drawPosition * sizeRatio, this->realSrcSize * sizeRatio);
-		if (this->clipRect.w > 0.0f && this->clipRect.h > 0.0f)
+		if (clipRect.w > 0.0f && clipRect.h > 0.0f)
 		{
-			grectf realClipRect(rect.getPosition() + this->clipRect.getPosition() * sizeRatio, this->clipRect.getSize() * sizeRatio);
+			grectf realClipRect(rect.getPosition() + clipRect.getPosition() * sizeRatio, clipRect.getSize() * sizeRatio);
 			drawRect.clip(realClipRect);
 		}
-		this->vertices[0].x = this->vertices[2].x = this->vertices[4].x = drawRect.left();
-		this->vertices[0].y = this->vertices[1].y = this->vertices[3].y = drawRect.top();
-		this->vertices[1].x = this->vertices[3].x = this->vertices[5].x = drawRect.right();
-		this->vertices[2].y = this->vertices[4].y = this->vertices[5].y = drawRect.bottom();
-		this->_setDeviceTexture();
-		this->tryLoadTextureCoordinates();
-		april::rendersys->setBlendMode(this->blendMode);
-		april::rendersys->setColorMode(this->colorMode, this->colorModeFactor);
-		april::rendersys->render(april::RenderOperation::TriangleList, this->vertices, APRILUI_IMAGE_MAX_VERTICES, drawColor);
+		return drawRect;
+	}
+
+	void CropImage::draw(cgrectf rect, const april::Color& color)
+	{
+		// cropping is handled by the clipped source and draw rects so the regular image drawing applies, including corner colors
+		Image::draw(rect, color);
 	}
 
 	void CropImage::draw(const harray<april::TexturedVertex>& vertices, const april::Color& color)
@@ -244,91 +244,68 @@ namespace aprilui
 	}
 
 	void Image::draw(cgrectf rect, const april::Color& color)
+	{
+		this->_drawClipped(rect, this->clipRect, color);
+	}
+
+	void Image::drawClipped(cgrectf rect, cgrectf clipRect, const april::Color& color)
+	{
+		this->_drawClipped(rect, clipRect, color);
+	}
+
+	void Image::_drawClipped(cgrectf rect, cgrectf clipRect, const april::Color& color)
 	{
 		if (color.a == 0)
 		{
 			return;
 		}
+		april::Color topLeft = this->colorTopLeft * color;
+		april::Color topRight;
+		april::Color bottomLeft;
+		april::Color bottomRight;
 		if (this->useAdditionalColors)
 		{
-			this->_drawWithCorners(rect, color);
-			return;
-		}
-		if (this->colorTopLeft.a == 0)
-		{
-			return;
-		}
-		april::Color drawColor = color;
-		if (this->colorTopLeft != april::Color::White)
-		{
-			drawColor *= this->colorTopLeft;
-			if (drawColor.a == 0)
+			topRight = this->colorTopRight * color;
+			bottomLeft = this->colorBottomLeft * color;
+			bottomRight = this->colorBottomRight * color;
+			if (topLeft.a == 0 && topRight.a == 0 && bottomLeft.a == 0 && bottomRight.a == 0)
 			{
 				return;
 			}
 		}
-		grectf drawRect = rect;
-		if (this->clipRect.w > 0.0f && this->clipRect.h > 0.0f)
+		else if (topLeft.a == 0)
 		{
-			gvec2f sizeRatio = drawRect.getSize() / this->srcRect.getSize();
-			drawRect += this->clipRect.getPosition() * sizeRatio;
-			drawRect.setSize(this->clipRect.getSize() * sizeRatio);
+			return;
 		}
-		this->vertices[0].x = this->vertices[2].x = this->vertices[4].x = drawRect.left();
-		this->vertices[0].y = this->vertices[1].y = this->vertices[3].y = drawRect.top();
-		this->vertices[1].x = this->vertices[3].x = this->vertices[5].x = drawRect.right();
-		this->vertices[2].y = this->vertices[4].y = this->vertices[5].y = drawRect.bottom();
-		this->_setDeviceTexture();
-		if (this->tryLoadTextureCoordinates())
+		if (!this->_setDeviceTexture())
 		{
-			for_iter (i, 0, APRILUI_IMAGE_MAX_VERTICES)
-			{
-				this->coloredVertices[i].u = this->vertices[i].u;
-				this->coloredVertices[i].v = this->vertices[i].v;
-			}
+			return;
 		}
-		april::rendersys->setBlendMode(this->blendMode);
-		april::rendersys->setColorMode(this->colorMode, this->colorModeFactor);
-		april::rendersys->render(april::RenderOperation::TriangleList, this->vertices, APRILUI_IMAGE_MAX_VERTICES, drawColor);
-	}
-
-	void Image::_drawWithCorners(cgrectf rect, const april::Color& color)
-	{
-		april::Color topLeft = this->colorTopLeft * color;
-		april::Color topRight = this->colorTopRight * color;
-		april::Color bottomLeft = this->colorBottomLeft * color;
-		april::Color bottomRight = this->colorBottomRight * color;
-		if (topLeft.a == 0 && topRight.a == 0 && bottomLeft.a == 0 && bottomRight.a == 0)
+		// texture coordinates are cached per clip rect, so the own clip rect and per-call clip rects share the same path
+		grectf textureRect;
+		if (!this->_findClippedTextureCoordinates(clipRect, textureRect))
 		{
 			return;
 		}
-		grectf drawRect = rect;
-		if (this->clipRect.w > 0.0f && this->clipRect.h > 0.0f)
+		grectf drawRect = this->_makeClippedDrawRect(rect, clipRect);
+		april::rendersys->setBlendMode(this->blendMode);
+		april::rendersys->setColorMode(this->colorMode, this->colorModeFactor);
+		if (this->useAdditionalColors)
 		{
-			gvec2f sizeRatio = drawRect.getSize() / this->srcRect.getSize();
-			drawRect += this->clipRect.getPosition() * sizeRatio;
-			drawRect.setSize(this->clipRect.getSize() * sizeRatio);
+			april::ColoredTexturedVertex vertices[APRILUI_IMAGE_MAX_VERTICES];
+			MinimalImage::_makeVertices(vertices, drawRect, textureRect);
+			vertices[0].color = april::rendersys->getNativeColorUInt(topLeft);
+			vertices[1].color = vertices[3].color = april::rendersys->getNativeColorUInt(topRight);
+			vertices[2].color = vertices[4].color = april::rendersys->getNativeColorUInt(bottomLeft);
+			vertices[5].color = april::rendersys->getNativeColorUInt(bottomRight);
+			april::rendersys->render(april::RenderOperation::TriangleList, vertices, APRILUI_IMAGE_MAX_VERTICES);
 		}
-		this->coloredVertices[0].x = this->coloredVertices[2].x = this->coloredVertices[4].x = drawRect.left();
-		this->coloredVertices[0].y = this->coloredVertices[1].y = this->coloredVertices[3].y = drawRect.top();
-		this->coloredVertices[1].x = this->coloredVertices[3].x = this->coloredVertices[5].x = drawRect.right();
-		this->coloredVertices[2].y = this->coloredVertices[4].y = this->coloredVertices[5].y = drawRect.bottom();
-		this->coloredVertices[0].color = april::rendersys->getNativeColorUInt(topLeft);
-		this->coloredVertices[1].color = this->coloredVertices[3].color = april::rendersys->getNativeColorUInt(topRight);
-		this->coloredVertices[2].color = this->coloredVertices[4].color = april::rendersys->getNativeColorUInt(bottomLeft);
-		this->coloredVertices[5].color = april::rendersys->getNativeColorUInt(bottomRight);
-		this->_setDeviceTexture();
-		if (this->tryLoadTextureCoordinates())
+		else
 		{
-			for_iter (i, 0, APRILUI_IMAGE_MAX_VERTICES)
-			{
-				this->coloredVertices[i].u = this->vertices[i].u;
-				this->coloredVertices[i].v = this->vertices[i].v;
-			}
+			april::TexturedVertex vertices[APRILUI_IMAGE_MAX_VERTICES];
+			MinimalImage::_makeVertices(vertices, drawRect, textureRect);
+			april::rendersys->render(april::RenderOperation::TriangleList, vertices, APRILUI_IMAGE_MAX_VERTICES, topLeft);
 		}
-		april::rendersys->setBlendMode(this->blendMode);
-		april::rendersys->setColorMode(this->colorMode, this->colorModeFactor);
-		april::rendersys->render(april::RenderOperation::TriangleList, this->coloredVertices, APRILUI_IMAGE_MAX_VERTICES);
 	}
 
 	void Image::draw(const harray<april::TexturedVertex>& vertices, const april::Color& color)
@@ -346,19 +323,15 @@ namespace aprilui
 				return;
 			}
 		}
-		this->_setDeviceTexture();
-		if (this->tryLoadTextureCoordinates())
+		if (!this->_setDeviceTexture())
 		{
-			for_iter (i, 0, APRILUI_IMAGE_MAX_VERTICES)
-			{
-				this->coloredVertices[i].u = this->vertices[i].u;
-				this->coloredVertices[i].v = this->vertices[i].v;
-			}
+			return;
 		}
+		this->tryLoadTextureCoordinates();
 		// texture coordinate scaling
 		float iw = 1.0f / this->texture->getWidth();
 		float ih = 1.0f / this->texture->getHeight();
-		grectf rect = this->_makeClippedSrcRect();
+		grectf rect = this->_makeClippedSrcRect(this->clipRect);
 		harray<april::TexturedVertex> textureVertices = vertices;
 		foreach (april::TexturedVertex, it, textureVertices)
 		{
@@ -11,6 +11,7 @@
 #include <gtypes/Vector2.h>
 #include <hltypes/hltypesUtil.h>
 
+#include "aprilui.h"
 #include "apriluiUtil.h"
 #include "Dataset.h"
 #include "Exception.h"
@@ -19,6 +20,8 @@
 
 namespace aprilui
 {
+	bool _tryUploadTexture(Texture* texture);
+
 	hmap<hstr, PropertyDescription> MinimalImage::_propertyDescriptions;
 	hmap<hstr, PropertyDescription::Accessor*> MinimalImage::_getters;
 	hmap<hstr, PropertyDescription::Accessor*> MinimalImage::_setters;
@@ -88,12 +91,23 @@ namespace aprilui
 		return MinimalImage::_setters;
 	}
 
+	void MinimalImage::setTexture(Texture* const& value)
+	{
+		if (this->texture != value)
+		{
+			this->texture = value;
+			this->_textureCoordinatesLoaded = false;
+			this->_clippedTextureCoordinates.clear();
+		}
+	}
+
 	void MinimalImage::setSrcRect(cgrectf value)
 	{
 		if (this->srcRect != value)
 		{
 			this->srcRect = value;
 			this->_textureCoordinatesLoaded = false;
+			this->_clippedTextureCoordinates.clear();
 		}
 	}
 
@@ -103,6 +117,7 @@ namespace aprilui
 		{
 			this->srcRect.set(x, y, width, height);
 			this->_textureCoordinatesLoaded = false;
+			this->_clippedTextureCoordinates.clear();
 		}
 	}
 
@@ -112,6 +127,7 @@ namespace aprilui
 		{
 			this->srcRect.x = value;
 			this->_textureCoordinatesLoaded = false;
+			this->_clippedTextureCoordinates.clear();
 		}
 	}
 
@@ -121,6 +137,7 @@ namespace aprilui
 		{
 			this->srcRect.y = value;
 			this->_textureCoordinatesLoaded = false;
+			this->_clippedTextureCoordinates.clear();
 		}
 	}
 
@@ -130,6 +147,7 @@ namespace aprilui
 		{
 			this->srcRect.w = value;
 			this->_textureCoordinatesLoaded = false;
+			this->_clippedTextureCoordinates.clear();
 		}
 	}
 
@@ -139,6 +157,7 @@ namespace aprilui
 		{
 			this->srcRect.h = value;
 			this->_textureCoordinatesLoaded = false;
+			this->_clippedTextureCoordinates.clear();
 		}
 	}
 
@@ -148,6 +167,7 @@ namespace aprilui
 		{
 			this->srcRect.setPosition(value);
 			this->_textureCoordinatesLoaded = false;
+			this->_clippedTextureCoordinates.clear();
 		}
 	}
 
@@ -157,6 +177,7 @@ namespace aprilui
 		{
 			this->srcRect.setPosition(x, y);
 			this->_textureCoordinatesLoaded = false;
+			this->_clippedTextureCoordinates.clear();
 		}
 	}
 
@@ -166,6 +187,7 @@ namespace aprilui
 		{
 			this->srcRect.setSize(value);
 			this->_textureCoordinatesLoaded = false;
+			this->_clippedTextureCoordinates.clear();
 		}
 	}
 
@@ -175,9 +197,20 @@ namespace aprilui
 		{
 			this->srcRect.setSize(w, h);
 			this->_textureCoordinatesLoaded = false;
+			this->_clippedTextureCoordinates.clear();
 		}
 	}
 
+	int64_t MinimalImage::getByteSize() const
+	{
+		return (BaseImage::getByteSize() + (int64_t)(sizeof(MinimalImage) - sizeof(BaseImage)));
+	}
+
+	int64_t MinimalImage::getCacheByteSize() const
+	{
+		return (int64_t)(this->_clippedTextureCoordinates.size() * sizeof(ClippedTextureCoordinates));
+	}
+
 	hstr MinimalImage::getProperty(chstr name)
 	{
 		if (name == "texture")
@@ -187,11 +220,23 @@ namespace aprilui
 		return BaseImage::getProperty(name);
 	}
 	
-	void MinimalImage::_setDeviceTexture()
+	bool MinimalImage::_setDeviceTexture()
 	{
 		if (this->texture != NULL) // to prevent a crash in Texture::load so that a possible crash happens below instead
 		{
 			this->texture->load();
+			this->texture->markUsed();
+			if (!_tryUploadTexture(this->texture))
+			{
+				Texture* placeholder = aprilui::getTextureUploadPlaceholder();
+				if (placeholder == NULL)
+				{
+					return false;
+				}
+				placeholder->load();
+				april::rendersys->setTexture(placeholder->getTexture());
+				return true;
+			}
 			april::rendersys->setTexture(this->texture->getTexture());
 		}
 		else
@@ -199,6 +244,7 @@ namespace aprilui
 			hlog::errorf(logTag, "Image '%s' has no texture assigned!", this->name.cStr());
 			april::rendersys->setTexture(NULL);
 		}
+		return true;
 	}
 
 	bool MinimalImage::tryLoadTextureCoordinates()
@@ -209,7 +255,7 @@ namespace aprilui
 			this->_clipRectCalculated = true;
 			float iw = 1.0f / this->texture->getWidth();
 			float ih = 1.0f / this->texture->getHeight();
-			grectf rect = this->_makeClippedSrcRect();
+			grectf rect = this->_makeClippedSrcRect(this->clipRect);
 			gvec2f topLeft;
 			gvec2f topRight;
 			gvec2f bottomLeft;
@@ -233,33 +279,78 @@ namespace aprilui
 		return false;
 	}
 
-	grectf MinimalImage::_makeClippedSrcRect() const
+	grectf MinimalImage::_makeClippedSrcRect(cgrectf clipRect) const
 	{
-		if (this->clipRect.w > 0.0f && this->clipRect.h > 0.0f)
+		if (clipRect.w > 0.0f && clipRect.h > 0.0f)
 		{
-			return this->srcRect.clipped(this->clipRect + this->srcRect.getPosition());
+			return this->srcRect.clipped(clipRect + this->srcRect.getPosition());
 		}
 		return this->srcRect;
 	}
 
+	grectf MinimalImage::_makeClippedDrawRect(cgrectf rect, cgrectf clipRect) const
+	{
+		grectf drawRect = rect;
+		if (clipRect.w > 0.0f && clipRect.h > 0.0f)
+		{
+			gvec2f sizeRatio = drawRect.getSize() / this->srcRect.getSize();
+			drawRect += clipRect.getPosition() * sizeRatio;
+			drawRect.setSize(clipRect.getSize() * sizeRatio);
+		}
+		return drawRect;
+	}
+
+	bool MinimalImage::_findClippedTextureCoordinates(cgrectf clipRect, grectf& textureRect)
+	{
+		if (this->texture == NULL)
+		{
+			return false;
+		}
+		gvec2i size(this->texture->getWidth(), this->texture->getHeight());
+		if (size.x <= 0 || size.y <= 0)
+		{
+			return false;
+		}
+		if (this->_clippedTextureCoordinatesTextureSize != size)
+		{
+			this->_clippedTextureCoordinatesTextureSize = size;
+			this->_clippedTextureCoordinates.clear();
+		}
+		foreachc (ClippedTextureCoordinates, it, this->_clippedTextureCoordinates)
+		{
+			if ((*it).first == clipRect)
+			{
+				textureRect = (*it).second;
+				return true;
+			}
+		}
+		grectf rect = this->_makeClippedSrcRect(clipRect);
+		float iw = 1.0f / size.x;
+		float ih = 1.0f / size.y;
+		textureRect.set(rect.x * iw, rect.y * ih, rect.w * iw, rect.h * ih);
+		if (this->_clippedTextureCoordinates.size() >= APRILUI_IMAGE_MAX_CLIPPED_TEXTURE_COORDINATES)
+		{
+			this->_clippedTextureCoordinates.removeAt(0);
+		}
+		this->_clippedTextureCoordinates += ClippedTextureCoordinates(clipRect, textureRect);
+		return true;
+	}
+
 	void MinimalImage::draw(cgrectf rect, const april::Color& color)
 	{
 		if (color.a == 0)
 		{
 			return;
 		}
-		grectf drawRect = rect;
-		if (this->clipRect.w > 0.0f && this->clipRect.h > 0.0f)
-		{
-			gvec2f sizeRatio = drawRect.getSize() / this->srcRect.getSize();
-			drawRect += this->clipRect.getPosition() * sizeRatio;
-			drawRect.setSize(this->clipRect.getSize() * sizeRatio);
-		}
+		grectf drawRect = this->_makeClippedDrawRect(rect, this->clipRect);
 		this->vertices[0].x = this->vertices[2].x = this->vertices[4].x = drawRect.left();
 		this->vertices[0].y = this->vertices[1].y = this->vertices[3].y = drawRect.top();
 		this->vertices[1].x = this->vertices[3].x = this->vertices[5].x = drawRect.right();
 		this->vertices[2].y = this->vertices[4].y = this->vertices[5].y = drawRect.bottom();
-		this->_setDeviceTexture();
+		if (!this->_setDeviceTexture())
+		{
+			return;
+		}
 		this->tryLoadTextureCoordinates();
 		april::rendersys->setBlendMode(april::BlendMode::Alpha);
 		april::rendersys->setColorMode(april::ColorMode::Multiply, 1.0f);
@@ -272,12 +363,15 @@ namespace aprilui
 		{
 			return;
 		}
-		this->_setDeviceTexture();
+		if (!this->_setDeviceTexture())
+		{
+			return;
+		}
 		this->tryLoadTextureCoordinates();
 		// texture coordinate scaling
 		float iw = 1.0f / this->texture->getWidth();
 		float ih = 1.0f / this->texture->getHeight();
-		grectf rect = this->_makeClippedSrcRect();
+		grectf rect = this->_makeClippedSrcRect(this->clipRect);
 		harray<april::TexturedVertex> textureVertices = vertices;
 		foreach (april::TexturedVertex, it, textureVertices)
 		{
@@ -288,5 +382,27 @@ namespace aprilui
 		april::rendersys->setColorMode(april::ColorMode::Multiply, 1.0f);
 		april::rendersys->render(april::RenderOperation::TriangleList, (april::TexturedVertex*)textureVertices, textureVertices.size(), color);
 	}
+
+	void MinimalImage::drawClipped(cgrectf rect, cgrectf clipRect, const april::Color& color)
+	{
+		if (color.a == 0)
+		{
+			return;
+		}
+		if (!this->_setDeviceTexture())
+		{
+			return;
+		}
+		grectf textureRect;
+		if (!this->_findClippedTextureCoordinates(clipRect, textureRect))
+		{
+			return;
+		}
+		april::TexturedVertex vertices[APRILUI_IMAGE_MAX_VERTICES];
+		MinimalImage::_makeVertices(vertices, this->_makeClippedDrawRect(rect, clipRect), textureRect);
+		april::rendersys->setBlendMode(april::BlendMode::Alpha);
+		april::rendersys->setColorMode(april::ColorMode::Multiply, 1.0f);
+		april::rendersys->render(april::RenderOperation::TriangleList, vertices, APRILUI_IMAGE_MAX_VERTICES, color);
+	}
 	
 }
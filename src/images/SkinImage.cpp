@@ -262,6 +262,16 @@ namespace aprilui
 		}
 	}
 
+	int64_t SkinImage::getCacheByteSize() const
+	{
+		int64_t result = Image::getCacheByteSize() + (int64_t)(this->_vertices.size() * sizeof(april::TexturedVertex));
+		for_iter (i, 0, this->_rectVertices.size())
+		{
+			result += (int64_t)(sizeof(RectVertices) + this->_rectVertices[i].second.size() * sizeof(april::TexturedVertex));
+		}
+		return result;
+	}
+
 	void SkinImage::draw(cgrectf rect, const april::Color& color)
 	{
 		if (color.a == 0 || this->colorTopLeft.a == 0)
@@ -282,7 +292,10 @@ namespace aprilui
 			this->_skinCoordinatesCalculated = false;
 			this->_clipRectCalculated = true; // not used for texture coordinates in this class so it's disabled
 		}
-		this->_setDeviceTexture();
+		if (!this->_setDeviceTexture())
+		{
+			return;
+		}
 		april::rendersys->setBlendMode(this->blendMode);
 		april::rendersys->setColorMode(this->colorMode, this->colorModeFactor);
 		grectf originalClipRect = this->clipRect; // prevents wrong calculations for src coordinates
@@ -594,6 +607,12 @@ namespace aprilui
 		}
 	}
 
+	void SkinImage::drawClipped(cgrectf rect, cgrectf clipRect, const april::Color& color)
+	{
+		// the clip rect is used in vertex calculations so the image's own clip rect is temporarily used
+		BaseImage::drawClipped(rect, clipRect, color);
+	}
+
 	void SkinImage::draw(const harray<april::TexturedVertex>& vertices, const april::Color& color)
 	{
 		hlog::warn(logTag, "SkinImage::draw(harray<april::TexturedVertex>, april::Color) is not supported!");
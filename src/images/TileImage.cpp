@@ -180,6 +180,11 @@ namespace aprilui
 		}
 	}
 
+	int64_t TileImage::getCacheByteSize() const
+	{
+		return (Image::getCacheByteSize() + (int64_t)(this->tileVertices.size() * sizeof(april::TexturedVertex)));
+	}
+
 	void TileImage::draw(cgrectf rect, const april::Color& color)
 	{
 		if (color.a == 0 || this->colorTopLeft.a == 0)
@@ -195,7 +200,10 @@ namespace aprilui
 				return;
 			}
 		}
-		this->_setDeviceTexture();
+		if (!this->_setDeviceTexture())
+		{
+			return;
+		}
 		bool recreateVertices = (!this->_textureCoordinatesLoaded || !this->_clipRectCalculated);
 		this->tryLoadTextureCoordinates();
 		if (recreateVertices || this->_lastScroll != this->scroll || this->_lastRect != rect)
@@ -213,6 +221,12 @@ namespace aprilui
 		april::rendersys->render(april::RenderOperation::TriangleList, (april::TexturedVertex*)this->tileVertices, this->tileVertices.size(), drawColor);
 	}
 
+	void TileImage::drawClipped(cgrectf rect, cgrectf clipRect, const april::Color& color)
+	{
+		// the clip rect is used in vertex calculations so the image's own clip rect is temporarily used
+		BaseImage::drawClipped(rect, clipRect, color);
+	}
+
 	void TileImage::draw(const harray<april::TexturedVertex>& vertices, const april::Color& color)
 	{
 		hlog::warn(logTag, "TileImage::draw(harray<april::TexturedVertex>, april::Color) is not supported!");
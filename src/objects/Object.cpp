@@ -50,6 +50,7 @@
 	Animator* animator ## type = new Animators::type(april::generateName("dynamic_animator_")); \
 	this->dynamicAnimators += animator ## type; \
 	animator ## type->parent = this; \
+	this->_requestUpdate(); \
 	animator ## type->setSpeed(speed); \
 	animator ## type->setPeriods(1.0f); \
 	if (delay == 0.0f) \
@@ -72,6 +73,7 @@
 	Animator* animator ## type = new Animators::type(april::generateName("dynamic_animator_")); \
 	this->dynamicAnimators += animator ## type; \
 	animator ## type->parent = this; \
+	this->_requestUpdate(); \
 	animator ## type->setOffset(offset); \
 	animator ## type->setAmplitude(amplitude); \
 	animator ## type->setAnimationFunction(function); \
@@ -98,6 +100,29 @@
 
 namespace aprilui
 {
+	// the axis aligned bounds of a rectangle transformed by a 2D modelview matrix
+	static grectf _makeTransformedBounds(const gmat4& matrix, cgrectf rect)
+	{
+		gvec2f corners[4] = {rect.getPosition(), gvec2f(rect.x + rect.w, rect.y), gvec2f(rect.x, rect.y + rect.h), rect.getPosition() + rect.getSize()};
+		gvec2f min;
+		gvec2f max;
+		gvec2f point;
+		for_iter (i, 0, 4)
+		{
+			point.set(matrix.data[0] * corners[i].x + matrix.data[4] * corners[i].y + matrix.data[12], matrix.data[1] * corners[i].x + matrix.data[5] * corners[i].y + matrix.data[13]);
+			if (i == 0)
+			{
+				min = max = point;
+			}
+			else
+			{
+				min.set(hmin(min.x, point.x), hmin(min.y, point.y));
+				max.set(hmax(max.x, point.x), hmax(max.y, point.y));
+			}
+		}
+		return grectf(min, max - min);
+	}
+
 	HL_ENUM_CLASS_DEFINE(Object::HitTest,
 	(
 		HL_ENUM_DEFINE(Object::HitTest, Enabled);
@@ -108,6 +133,7 @@ namespace aprilui
 	hmap<hstr, PropertyDescription> Object::_propertyDescriptions;
 	hmap<hstr, PropertyDescription::Accessor*> Object::_getters;
 	hmap<hstr, PropertyDescription::Accessor*> Object::_setters;
+	harray<Object*> Object::_inputChildren;
 
 	Object::Object(chstr name) :
 		BaseObject(name)
@@ -126,6 +152,7 @@ namespace aprilui
 		this->useClipRound = true;
 		this->inheritAlpha = true;
 		this->useDisabledAlpha = true;
+		this->captureTouches = false;
 		this->disabledAlphaFactor = 0.5f;
 		this->focusIndex = -1;
 		this->customPointInsideCallback = NULL;
@@ -134,6 +161,7 @@ namespace aprilui
 		this->_initialPivotY = true;
 		this->_childUnderCursor = NULL;
 		this->_checkedChildUnderCursor = false;
+		this->_dispatchingInput = false;
 	}
 
 	Object::Object(const Object& other) :
@@ -157,6 +185,7 @@ namespace aprilui
 		this->useClipRound = other.clip;
 		this->inheritAlpha = other.inheritAlpha;
 		this->useDisabledAlpha = other.useDisabledAlpha;
+		this->captureTouches = other.captureTouches;
 		this->disabledAlphaFactor = other.disabledAlphaFactor;
 		this->focusIndex = other.focusIndex;
 		this->customPointInsideCallback = other.customPointInsideCallback;
@@ -171,6 +200,7 @@ namespace aprilui
 		this->_initialPivotY = other._initialPivotY;
 		this->_childUnderCursor = NULL;
 		this->_checkedChildUnderCursor = false;
+		this->_dispatchingInput = false;
 	}
 
 	Object::~Object()
@@ -199,13 +229,34 @@ namespace aprilui
 		foreachc (Object*, it, objects)
 		{
 			object = (*it)->clone();
-			this->addChild(object);
+			this->_appendChild(object);
 			object->_cloneChildren((*it)->childrenObjects, (*it)->childrenAnimators);
 		}
 		foreachc (Animator*, it, animators)
 		{
-			this->addChild((*it)->clone());
+			this->_appendChild((*it)->clone());
 		}
+		this->_invalidateDrawList();
+	}
+
+	void Object::_appendChild(BaseObject* obj)
+	{
+		Object* object = dynamic_cast<Object*>(obj);
+		if (object != NULL)
+		{
+			this->childrenObjects += object;
+		}
+		else
+		{
+			Animator* animator = dynamic_cast<Animator*>(obj);
+			if (animator != NULL)
+			{
+				this->childrenAnimators += animator;
+				this->_requestUpdate();
+			}
+		}
+		obj->parent = this;
+		obj->notifyEvent(Event::AttachedToObjectId, NULL);
 	}
 
 	hmap<hstr, PropertyDescription>& Object::getPropertyDescriptions() const
@@ -247,6 +298,7 @@ namespace aprilui
 			Object::_propertyDescriptions["clip"] = PropertyDescription("clip", PropertyDescription::Type::Bool);
 			Object::_propertyDescriptions["use_clip_round"] = PropertyDescription("use_clip_round", PropertyDescription::Type::Bool);
 			Object::_propertyDescriptions["use_disabled_alpha"] = PropertyDescription("use_disabled_alpha", PropertyDescription::Type::Bool);
+			Object::_propertyDescriptions["capture_touches"] = PropertyDescription("capture_touches", PropertyDescription::Type::Bool);
 			Object::_propertyDescriptions["disabled_alpha_factor"] = PropertyDescription("disabled_alpha_factor", PropertyDescription::Type::Float);
 			Object::_propertyDescriptions["focus_index"] = PropertyDescription("focus_index", PropertyDescription::Type::Int);
 		}
@@ -290,6 +342,7 @@ namespace aprilui
 			Object::_getters["clip"] = new PropertyDescription::Get<Object, bool>(&Object::isClip);
 			Object::_getters["use_clip_round"] = new PropertyDescription::Get<Object, bool>(&Object::isUseClipRound);
 			Object::_getters["use_disabled_alpha"] = new PropertyDescription::Get<Object, bool>(&Object::isUseDisabledAlpha);
+			Object::_getters["capture_touches"] = new PropertyDescription::Get<Object, bool>(&Object::isCaptureTouches);
 			Object::_getters["disabled_alpha_factor"] = new PropertyDescription::Get<Object, float>(&Object::getDisabledAlphaFactor);
 			Object::_getters["focus_index"] = new PropertyDescription::Get<Object, int>(&Object::getFocusIndex);
 		}
@@ -333,6 +386,7 @@ namespace aprilui
 			Object::_setters["clip"] = new PropertyDescription::Set<Object, bool>(&Object::setClip);
 			Object::_setters["use_clip_round"] = new PropertyDescription::Set<Object, bool>(&Object::setUseClipRound);
 			Object::_setters["use_disabled_alpha"] = new PropertyDescription::Set<Object, bool>(&Object::setUseDisabledAlpha);
+			Object::_setters["capture_touches"] = new PropertyDescription::Set<Object, bool>(&Object::setCaptureTouches);
 			Object::_setters["disabled_alpha_factor"] = new PropertyDescription::Set<Object, float>(&Object::setDisabledAlphaFactor);
 			Object::_setters["focus_index"] = new PropertyDescription::Set<Object, int>(&Object::setFocusIndex);
 		}
@@ -346,8 +400,9 @@ namespace aprilui
 		this->_updateChildrenHorizontal(correctedSize.x - this->rect.w);
 		this->_updateChildrenVertical(correctedSize.y - this->rect.h);
 		this->rect.set(value.getPosition(), correctedSize);
-		this->notifyEvent(Event::PositionChanged, NULL);
-		this->notifyEvent(Event::SizeChanged, NULL);
+		this->_invalidateDrawList();
+		this->notifyEvent(Event::PositionChangedId, NULL);
+		this->notifyEvent(Event::SizeChangedId, NULL);
 	}
 
 	void Object::setRect(cgvec2f position, cgvec2f size)
@@ -357,8 +412,9 @@ namespace aprilui
 		this->_updateChildrenHorizontal(correctedSize.x - this->rect.w);
 		this->_updateChildrenVertical(correctedSize.y - this->rect.h);
 		this->rect.set(position, correctedSize);
-		this->notifyEvent(Event::PositionChanged, NULL);
-		this->notifyEvent(Event::SizeChanged, NULL);
+		this->_invalidateDrawList();
+		this->notifyEvent(Event::PositionChangedId, NULL);
+		this->notifyEvent(Event::SizeChangedId, NULL);
 	}
 
 	void Object::setRect(cgvec2f position, const float& w, const float& h)
@@ -368,8 +424,9 @@ namespace aprilui
 		this->_updateChildrenHorizontal(correctedSize.x - this->rect.w);
 		this->_updateChildrenVertical(correctedSize.y - this->rect.h);
 		this->rect.set(position, correctedSize);
-		this->notifyEvent(Event::PositionChanged, NULL);
-		this->notifyEvent(Event::SizeChanged, NULL);
+		this->_invalidateDrawList();
+		this->notifyEvent(Event::PositionChangedId, NULL);
+		this->notifyEvent(Event::SizeChangedId, NULL);
 	}
 
 	void Object::setRect(const float& x, const float& y, cgvec2f size)
@@ -379,8 +436,9 @@ namespace aprilui
 		this->_updateChildrenHorizontal(correctedSize.x - this->rect.w);
 		this->_updateChildrenVertical(correctedSize.y - this->rect.h);
 		this->rect.set(x, y, correctedSize);
-		this->notifyEvent(Event::PositionChanged, NULL);
-		this->notifyEvent(Event::SizeChanged, NULL);
+		this->_invalidateDrawList();
+		this->notifyEvent(Event::PositionChangedId, NULL);
+		this->notifyEvent(Event::SizeChangedId, NULL);
 	}
 
 	void Object::setRect(const float& x, const float& y, const float& w, const float& h)
@@ -390,20 +448,23 @@ namespace aprilui
 		this->_updateChildrenHorizontal(correctedSize.x - this->rect.w);
 		this->_updateChildrenVertical(correctedSize.y - this->rect.h);
 		this->rect.set(x, y, correctedSize);
-		this->notifyEvent(Event::PositionChanged, NULL);
-		this->notifyEvent(Event::SizeChanged, NULL);
+		this->_invalidateDrawList();
+		this->notifyEvent(Event::PositionChangedId, NULL);
+		this->notifyEvent(Event::SizeChangedId, NULL);
 	}
 
 	void Object::setX(const float& value)
 	{
 		this->rect.x = value;
-		this->notifyEvent(Event::PositionChanged, NULL);
+		this->_invalidateDrawList();
+		this->notifyEvent(Event::PositionChangedId, NULL);
 	}
 
 	void Object::setY(const float& value)
 	{
 		this->rect.y = value;
-		this->notifyEvent(Event::PositionChanged, NULL);
+		this->_invalidateDrawList();
+		this->notifyEvent(Event::PositionChangedId, NULL);
 	}
 
 	void Object::setWidth(const float& value)
@@ -412,7 +473,8 @@ namespace aprilui
 		float correctedValue = this->_makeCorrectedWidth(this->unlimitedSize.x);
 		this->_updateChildrenHorizontal(correctedValue - this->rect.w);
 		this->rect.w = correctedValue;
-		this->notifyEvent(Event::SizeChanged, NULL);
+		this->_invalidateDrawList();
+		this->notifyEvent(Event::SizeChangedId, NULL);
 	}
 
 	void Object::setHeight(const float& value)
@@ -421,19 +483,22 @@ namespace aprilui
 		float correctedValue = this->_makeCorrectedHeight(this->unlimitedSize.y);
 		this->_updateChildrenVertical(correctedValue - this->rect.h);
 		this->rect.h = correctedValue;
-		this->notifyEvent(Event::SizeChanged, NULL);
+		this->_invalidateDrawList();
+		this->notifyEvent(Event::SizeChangedId, NULL);
 	}
 
 	void Object::setPosition(cgvec2f value)
 	{
 		this->rect.setPosition(value);
-		this->notifyEvent(Event::PositionChanged, NULL);
+		this->_invalidateDrawList();
+		this->notifyEvent(Event::PositionChangedId, NULL);
 	}
 
 	void Object::setPosition(const float& x, const float& y)
 	{
 		this->rect.setPosition(x, y);
-		this->notifyEvent(Event::PositionChanged, NULL);
+		this->_invalidateDrawList();
+		this->notifyEvent(Event::PositionChangedId, NULL);
 	}
 
 	void Object::setSize(cgvec2f value)
@@ -443,7 +508,8 @@ namespace aprilui
 		this->_updateChildrenHorizontal(correctedSize.x - this->rect.w);
 		this->_updateChildrenVertical(correctedSize.y - this->rect.h);
 		this->rect.setSize(correctedSize);
-		this->notifyEvent(Event::SizeChanged, NULL);
+		this->_invalidateDrawList();
+		this->notifyEvent(Event::SizeChangedId, NULL);
 	}
 
 	void Object::setSize(const float& w, const float& h)
@@ -453,7 +519,8 @@ namespace aprilui
 		this->_updateChildrenHorizontal(correctedSize.x - this->rect.w);
 		this->_updateChildrenVertical(correctedSize.y - this->rect.h);
 		this->rect.setSize(correctedSize);
-		this->notifyEvent(Event::SizeChanged, NULL);
+		this->_invalidateDrawList();
+		this->notifyEvent(Event::SizeChangedId, NULL);
 	}
 
 	void Object::setMaxSize(cgvec2f value)
@@ -470,7 +537,8 @@ namespace aprilui
 			this->_updateChildrenHorizontal(correctedSize.x - this->rect.w);
 			this->_updateChildrenVertical(correctedSize.y - this->rect.h);
 			this->rect.setSize(correctedSize);
-			this->notifyEvent(Event::SizeChanged, NULL);
+			this->_invalidateDrawList();
+			this->notifyEvent(Event::SizeChangedId, NULL);
 		}
 	}
 
@@ -503,6 +571,171 @@ namespace aprilui
 		}
 	}
 
+	void Object::setPivot(cgvec2f value)
+	{
+		if (this->pivot != value)
+		{
+			this->pivot = value;
+			this->_invalidateDrawList();
+		}
+	}
+
+	void Object::setPivot(float x, float y)
+	{
+		this->setPivot(gvec2f(x, y));
+	}
+
+	void Object::setPivotX(const float& value)
+	{
+		this->setPivot(gvec2f(value, this->pivot.y));
+	}
+
+	void Object::setPivotY(const float& value)
+	{
+		this->setPivot(gvec2f(this->pivot.x, value));
+	}
+
+	void Object::setColor(const april::Color& value)
+	{
+		// only a change of visibility affects the draw list
+		if ((this->color.a == 0) != (value.a == 0))
+		{
+			this->_invalidateDrawList();
+		}
+		if (this->color != value)
+		{
+			this->color = value;
+			this->_requestRedraw();
+		}
+	}
+
+	void Object::setRed(const unsigned char& value)
+	{
+		if (this->color.r != value)
+		{
+			this->color.r = value;
+			this->_requestRedraw();
+		}
+	}
+
+	void Object::setGreen(const unsigned char& value)
+	{
+		if (this->color.g != value)
+		{
+			this->color.g = value;
+			this->_requestRedraw();
+		}
+	}
+
+	void Object::setBlue(const unsigned char& value)
+	{
+		if (this->color.b != value)
+		{
+			this->color.b = value;
+			this->_requestRedraw();
+		}
+	}
+
+	void Object::setAlpha(const unsigned char& value)
+	{
+		if ((this->color.a == 0) != (value == 0))
+		{
+			this->_invalidateDrawList();
+		}
+		if (this->color.a != value)
+		{
+			this->color.a = value;
+			this->_requestRedraw();
+		}
+	}
+
+	void Object::setInheritAlpha(const bool& value)
+	{
+		if (this->inheritAlpha != value)
+		{
+			this->inheritAlpha = value;
+			this->_requestRedraw();
+		}
+	}
+
+	void Object::setUseDisabledAlpha(const bool& value)
+	{
+		if (this->useDisabledAlpha != value)
+		{
+			this->useDisabledAlpha = value;
+			this->_requestRedraw();
+		}
+	}
+
+	void Object::setDisabledAlphaFactor(const float& value)
+	{
+		if (this->disabledAlphaFactor != value)
+		{
+			this->disabledAlphaFactor = value;
+			this->_requestRedraw();
+		}
+	}
+
+	void Object::setVisible(const bool& value)
+	{
+		if (this->visible != value)
+		{
+			this->visible = value;
+			this->_invalidateDrawList();
+		}
+	}
+
+	void Object::setScale(cgvec2f value)
+	{
+		if (this->scaleFactor != value)
+		{
+			this->scaleFactor = value;
+			this->_invalidateDrawList();
+		}
+	}
+
+	void Object::setScale(float x, float y)
+	{
+		this->setScale(gvec2f(x, y));
+	}
+
+	void Object::setScaleX(const float& value)
+	{
+		this->setScale(gvec2f(value, this->scaleFactor.y));
+	}
+
+	void Object::setScaleY(const float& value)
+	{
+		this->setScale(gvec2f(this->scaleFactor.x, value));
+	}
+
+	void Object::setAngle(const float& value)
+	{
+		if (this->angle != value)
+		{
+			this->angle = value;
+			this->_invalidateDrawList();
+		}
+	}
+
+	void Object::setClip(const bool& value)
+	{
+		if (this->clip != value)
+		{
+			this->clip = value;
+			this->_invalidateDrawList();
+		}
+	}
+
+	void Object::setUseClipRound(const bool& value)
+	{
+		if (this->useClipRound != value)
+		{
+			this->useClipRound = value;
+			this->_invalidateDrawList();
+		}
+	}
+
 	bool Object::isDerivedVisible() const
 	{
 		return (this->isVisible() && (this->parent == NULL || this->parent->isDerivedVisible()));
@@ -581,6 +814,11 @@ namespace aprilui
 		return harray<BaseImage*>();
 	}
 
+	int64_t Object::getByteSize() const
+	{
+		return (BaseObject::getByteSize() + (int64_t)(sizeof(Object) - sizeof(BaseObject)));
+	}
+
 	Object* Object::getChildUnderCursor()
 	{
 		if (!this->_checkedChildUnderCursor)
@@ -686,10 +924,22 @@ namespace aprilui
 		{
 			april::rendersys->scale(this->scaleFactor.x, this->scaleFactor.y, 1.0f);
 		}
-		this->_draw();
-		if (aprilui::isDebugEnabled())
+		if (Dataset::_drawBoundsRecording)
 		{
-			this->_drawDebug();
+			this->_drawBoundingRect = _makeTransformedBounds(april::rendersys->getModelviewMatrix(), this->_makeDrawBounds());
+		}
+		// when redrawing only changed areas, other objects are skipped
+		if (Dataset::_drawDirtyRect == NULL || this->_drawBoundingRect.intersects(*Dataset::_drawDirtyRect))
+		{
+			if (Dataset::_drawListRecorder != NULL)
+			{
+				Dataset::_drawListRecorder->_recordDrawListEntry(this);
+			}
+			this->_draw();
+			if (aprilui::isDebugEnabled())
+			{
+				this->_drawDebug();
+			}
 		}
 		if (this->pivot.x != 0.0f || this->pivot.y != 0.0f)
 		{
@@ -707,6 +957,14 @@ namespace aprilui
 		april::rendersys->setModelviewMatrix(this->_drawModelviewMatrix);
 	}
 
+	void Object::_requestRedraw()
+	{
+		if (this->dataset != NULL)
+		{
+			this->dataset->requestRedraw(this);
+		}
+	}
+
 	void Object::_draw()
 	{
 	}
@@ -809,6 +1067,7 @@ namespace aprilui
 	void Object::resetPivot()
 	{
 		this->pivot = this->rect.getSize() / 2;
+		this->_invalidateDrawList();
 	}
 
 	harray<gvec2f> Object::transformToLocalSpace(const harray<gvec2f>& points, aprilui::Object* overrideRoot) const
@@ -1088,8 +1347,8 @@ namespace aprilui
 		Object* object = dynamic_cast<Object*>(obj);
 		if (object != NULL)
 		{
-			this->childrenObjects += object;
-			this->_sortChildren();
+			this->_insertChild(object);
+			this->_invalidateDrawList();
 		}
 		else
 		{
@@ -1097,10 +1356,57 @@ namespace aprilui
 			if (animator != NULL)
 			{
 				this->childrenAnimators += animator;
+				this->_requestUpdate();
 			}
 		}
 		obj->parent = this;
-		obj->notifyEvent(Event::AttachedToObject, NULL);
+		obj->notifyEvent(Event::AttachedToObjectId, NULL);
+	}
+
+	void Object::addChildren(const harray<BaseObject*>& objects)
+	{
+		foreachc (BaseObject*, it, objects)
+		{
+			if ((*it) == NULL)
+			{
+				// this exception cannot be disabled on purpose
+				throw ObjectNotExistsException("Object", "NULL", this->name);
+			}
+			if ((*it)->getParent() != NULL)
+			{
+				__THROW_EXCEPTION(ObjectHasParentException((*it)->getName(), this->getName()), aprilui::childManipulationDebugExceptionsEnabled, return);
+			}
+		}
+		int sortedCount = this->childrenObjects.size();
+		Object* object = NULL;
+		Animator* animator = NULL;
+		foreachc (BaseObject*, it, objects)
+		{
+			object = dynamic_cast<Object*>(*it);
+			if (object != NULL)
+			{
+				this->childrenObjects += object;
+			}
+			else
+			{
+				animator = dynamic_cast<Animator*>(*it);
+				if (animator != NULL)
+				{
+					this->childrenAnimators += animator;
+					this->_requestUpdate();
+				}
+			}
+			(*it)->parent = this;
+		}
+		if (this->childrenObjects.size() > sortedCount)
+		{
+			this->_mergeChildren(sortedCount);
+			this->_invalidateDrawList();
+		}
+		foreachc (BaseObject*, it, objects)
+		{
+			(*it)->notifyEvent(Event::AttachedToObjectId, NULL);
+		}
 	}
 
 	void Object::removeChild(BaseObject* obj)
@@ -1120,12 +1426,17 @@ namespace aprilui
 			root->clearChildUnderCursor();
 			root = root->getParent();
 		}
-		obj->notifyEvent(Event::DetachedFromObject, NULL);
+		obj->notifyEvent(Event::DetachedFromObjectId, NULL);
 		Object* object = dynamic_cast<Object*>(obj);
 		if (object != NULL)
 		{
 			object->clearDescendantChildrenUnderCursor();
+			if (object->dataset != NULL)
+			{
+				object->dataset->_releaseTouches(object);
+			}
 			this->childrenObjects -= object;
+			this->_invalidateDrawList();
 		}
 		else
 		{
@@ -1348,6 +1659,11 @@ namespace aprilui
 		return grectf(-this->pivot, this->rect.getSize());
 	}
 
+	grectf Object::_makeDrawBounds()
+	{
+		return this->_makeDrawRect();
+	}
+
 	gvec2f Object::_makeCorrectedSize(cgvec2f size)
 	{
 		return gvec2f(this->_makeCorrectedWidth(size.x), this->_makeCorrectedHeight(size.y));
@@ -1363,9 +1679,40 @@ namespace aprilui
 		return (this->maxSize.y > 0.0f ? hmin(height, this->maxSize.y) : height);
 	}
 
+	bool Object::_isInputEnabled() const
+	{
+		if (!this->isEnabled())
+		{
+			return false;
+		}
+		if (this->parent == NULL)
+		{
+			return true;
+		}
+		// a parent that is passing input has already been checked, but its own flag could have been changed by an event in the meantime
+		return (this->parent->_dispatchingInput ? this->parent->isEnabled() : this->parent->isDerivedEnabled());
+	}
+
+	int Object::_pushInputChildren()
+	{
+		int first = Object::_inputChildren.size();
+		Object::_inputChildren += this->childrenObjects;
+		this->_dispatchingInput = true;
+		return first;
+	}
+
+	void Object::_popInputChildren(int first)
+	{
+		while (Object::_inputChildren.size() > first)
+		{
+			Object::_inputChildren.removeLast();
+		}
+		this->_dispatchingInput = false;
+	}
+
 	bool Object::onMouseDown(april::Key keyCode)
 	{
-		if (this->hitTest == HitTest::DisabledRecursive || !this->isVisible() || !this->isDerivedEnabled())
+		if (this->hitTest == HitTest::DisabledRecursive || !this->isVisible() || !this->_isInputEnabled())
 		{
 			return false;
 		}
@@ -1373,15 +1720,17 @@ namespace aprilui
 		{
 			this->dataset->removeFocus();
 		}
-		// needs to be copied in case children gets changed
-		harray<Object*> objects = this->childrenObjects;
-		foreach_r (Object*, it, objects)
+		// children are copied in case they get changed
+		int first = this->_pushInputChildren();
+		for_iter_r (i, Object::_inputChildren.size(), first)
 		{
-			if ((*it)->onMouseDown(keyCode))
+			if (Object::_inputChildren[i]->onMouseDown(keyCode))
 			{
+				this->_popInputChildren(first);
 				return true;
 			}
 		}
+		this->_popInputChildren(first);
 		return this->_mouseDown(keyCode);
 	}
 
@@ -1392,38 +1741,33 @@ namespace aprilui
 
 	bool Object::onMouseUp(april::Key keyCode)
 	{
-		if (this->hitTest == HitTest::DisabledRecursive || !this->isVisible() || !this->isDerivedEnabled())
+		if (this->hitTest == HitTest::DisabledRecursive || !this->isVisible() || !this->_isInputEnabled())
 		{
 			return false;
 		}
-		harray<Object*> canceledObjects;
-		Object* object = NULL;
-		// needs to be copied in case children gets changed
-		harray<Object*> objects = this->childrenObjects;
-		for_iter_r (i, objects.size(), 0)
+		// children are copied in case they get changed
+		int first = this->_pushInputChildren();
+		int last = Object::_inputChildren.size() - 1;
+		for_iter_r (i, last + 1, first)
 		{
-			if (objects[i]->onMouseUp(keyCode))
+			if (Object::_inputChildren[i]->onMouseUp(keyCode))
 			{
-				object = objects[i];
-				++i;
-				if (i < objects.size())
+				// does not call onMouseCancel() on self, because it would affect all children, not just a select few
+				this->_mouseCancel(keyCode);
+				// children that were checked before are canceled in the order they were checked and then once more in Z order
+				for_iter_r (j, last + 1, i + 1)
 				{
-					canceledObjects += objects(i, -1);
+					Object::_inputChildren[j]->onMouseCancel(keyCode);
 				}
-				break;
-			}
-			canceledObjects += objects[i];
-		}
-		if (object != NULL)
-		{
-			// does not call onMouseCancel() on self, because it would affect all children, not just a select few
-			this->_mouseCancel(keyCode);
-			foreach (Object*, it, canceledObjects)
-			{
-				(*it)->onMouseCancel(keyCode);
+				for_iter (j, i + 1, last + 1)
+				{
+					Object::_inputChildren[j]->onMouseCancel(keyCode);
+				}
+				this->_popInputChildren(first);
+				return true;
 			}
-			return true;
 		}
+		this->_popInputChildren(first);
 		return this->_mouseUp(keyCode);
 	}
 
@@ -1434,12 +1778,13 @@ namespace aprilui
 
 	bool Object::onMouseCancel(april::Key keyCode)
 	{
-		harray<Object*> objects = this->childrenObjects;
+		int first = this->_pushInputChildren();
 		this->_mouseCancel(keyCode); // _mouseCancel() is the only one that is first called on this object and then on all children afterwards
-		foreach_r (Object*, it, objects)
+		for_iter_r (i, Object::_inputChildren.size(), first)
 		{
-			(*it)->onMouseCancel(keyCode);
+			Object::_inputChildren[i]->onMouseCancel(keyCode);
 		}
+		this->_popInputChildren(first);
 		return false;
 	}
 
@@ -1449,19 +1794,21 @@ namespace aprilui
 
 	bool Object::onMouseMove()
 	{
-		if (!this->isVisible() || !this->isDerivedEnabled())
+		if (!this->isVisible() || !this->_isInputEnabled())
 		{
 			return false;
 		}
-		// needs to be copied in case children gets changed
-		harray<Object*> objects = this->childrenObjects;
-		foreach_r (Object*, it, objects)
+		// children are copied in case they get changed
+		int first = this->_pushInputChildren();
+		for_iter_r (i, Object::_inputChildren.size(), first)
 		{
-			if ((*it)->onMouseMove())
+			if (Object::_inputChildren[i]->onMouseMove())
 			{
+				this->_popInputChildren(first);
 				return true;
 			}
 		}
+		this->_popInputChildren(first);
 		return this->_mouseMove();
 	}
 
@@ -1470,21 +1817,28 @@ namespace aprilui
 		return false;
 	}
 
+	bool Object::_isTrackingPointer() const
+	{
+		return false;
+	}
+
 	bool Object::onMouseScroll(float x, float y)
 	{
-		if (!this->isVisible() || !this->isDerivedEnabled())
+		if (!this->isVisible() || !this->_isInputEnabled())
 		{
 			return false;
 		}
-		// needs to be copied in case children gets changed
-		harray<Object*> objects = this->childrenObjects;
-		foreach_r (Object*, it, objects)
+		// children are copied in case they get changed
+		int first = this->_pushInputChildren();
+		for_iter_r (i, Object::_inputChildren.size(), first)
 		{
-			if ((*it)->onMouseScroll(x, y))
+			if (Object::_inputChildren[i]->onMouseScroll(x, y))
 			{
+				this->_popInputChildren(first);
 				return true;
 			}
 		}
+		this->_popInputChildren(first);
 		return this->_mouseScroll(x, y);
 	}
 
@@ -1495,19 +1849,21 @@ namespace aprilui
 
 	bool Object::onKeyDown(april::Key keyCode)
 	{
-		if (!this->isVisible() || !this->isDerivedEnabled())
+		if (!this->isVisible() || !this->_isInputEnabled())
 		{
 			return false;
 		}
-		// needs to be copied in case children gets changed
-		harray<Object*> objects = this->childrenObjects;
-		foreach_r (Object*, it, objects)
+		// children are copied in case they get changed
+		int first = this->_pushInputChildren();
+		for_iter_r (i, Object::_inputChildren.size(), first)
 		{
-			if ((*it)->onKeyDown(keyCode))
+			if (Object::_inputChildren[i]->onKeyDown(keyCode))
 			{
+				this->_popInputChildren(first);
 				return true;
 			}
 		}
+		this->_popInputChildren(first);
 		return this->_keyDown(keyCode);
 	}
 
@@ -1518,19 +1874,21 @@ namespace aprilui
 
 	bool Object::onKeyUp(april::Key keyCode)
 	{
-		if (!this->isVisible() || !this->isDerivedEnabled())
+		if (!this->isVisible() || !this->_isInputEnabled())
 		{
 			return false;
 		}
-		// needs to be copied in case children gets changed
-		harray<Object*> objects = this->childrenObjects;
-		foreach_r (Object*, it, objects)
+		// children are copied in case they get changed
+		int first = this->_pushInputChildren();
+		for_iter_r (i, Object::_inputChildren.size(), first)
 		{
-			if ((*it)->onKeyUp(keyCode))
+			if (Object::_inputChildren[i]->onKeyUp(keyCode))
 			{
+				this->_popInputChildren(first);
 				return true;
 			}
 		}
+		this->_popInputChildren(first);
 		return this->_keyUp(keyCode);
 	}
 	
@@ -1541,19 +1899,21 @@ namespace aprilui
 	
 	bool Object::onChar(unsigned int charCode)
 	{
-		if (!this->isVisible() || !this->isDerivedEnabled())
+		if (!this->isVisible() || !this->_isInputEnabled())
 		{
 			return false;
 		}
-		// needs to be copied in case children gets changed
-		harray<Object*> objects = this->childrenObjects;
-		foreach_r (Object*, it, objects)
+		// children are copied in case they get changed
+		int first = this->_pushInputChildren();
+		for_iter_r (i, Object::_inputChildren.size(), first)
 		{
-			if ((*it)->onChar(charCode))
+			if (Object::_inputChildren[i]->onChar(charCode))
 			{
+				this->_popInputChildren(first);
 				return true;
 			}
 		}
+		this->_popInputChildren(first);
 		return this->_char(charCode); // charcoal
 	}
 
@@ -1564,20 +1924,30 @@ namespace aprilui
 
 	bool Object::onTouchDown(int index)
 	{
-		if (this->hitTest == HitTest::DisabledRecursive || !this->isVisible() || !this->isDerivedEnabled())
+		if (this->hitTest == HitTest::DisabledRecursive || !this->isVisible() || !this->_isInputEnabled())
 		{
 			return false;
 		}
-		// needs to be copied in case children gets changed
-		harray<Object*> objects = this->childrenObjects;
-		foreach_r (Object*, it, objects)
+		// children are copied in case they get changed
+		int first = this->_pushInputChildren();
+		for_iter_r (i, Object::_inputChildren.size(), first)
 		{
-			if ((*it)->onTouchDown(index))
+			if (Object::_inputChildren[i]->onTouchDown(index))
 			{
+				this->_popInputChildren(first);
 				return true;
 			}
 		}
-		return this->_touchDown(index);
+		this->_popInputChildren(first);
+		if (!this->_touchDown(index))
+		{
+			return false;
+		}
+		if (this->captureTouches && this->dataset != NULL)
+		{
+			this->dataset->captureTouch(index, this);
+		}
+		return true;
 	}
 
 	bool Object::_touchDown(int index)
@@ -1587,38 +1957,33 @@ namespace aprilui
 
 	bool Object::onTouchUp(int index)
 	{
-		if (this->hitTest == HitTest::DisabledRecursive || !this->isVisible() || !this->isDerivedEnabled())
+		if (this->hitTest == HitTest::DisabledRecursive || !this->isVisible() || !this->_isInputEnabled())
 		{
 			return false;
 		}
-		harray<Object*> canceledObjects;
-		Object* object = NULL;
-		// needs to be copied in case children gets changed
-		harray<Object*> objects = this->childrenObjects;
-		for_iter_r (i, objects.size(), 0)
+		// children are copied in case they get changed
+		int first = this->_pushInputChildren();
+		int last = Object::_inputChildren.size() - 1;
+		for_iter_r (i, last + 1, first)
 		{
-			if (objects[i]->onTouchUp(index))
+			if (Object::_inputChildren[i]->onTouchUp(index))
 			{
-				object = objects[i];
-				++i;
-				if (i < objects.size())
+				// does not call onTouchCancel() on self, because it would affect all children, not just a select few
+				this->_touchCancel(index);
+				// children that were checked before are canceled in the order they were checked and then once more in Z order
+				for_iter_r (j, last + 1, i + 1)
 				{
-					canceledObjects += objects(i, -1);
+					Object::_inputChildren[j]->onTouchCancel(index);
 				}
-				break;
-			}
-			canceledObjects += objects[i];
-		}
-		if (object != NULL)
-		{
-			// does not call onTouchCancel() on self, because it would affect all children, not just a select few
-			this->_touchCancel(index);
-			foreach (Object*, it, canceledObjects)
-			{
-				(*it)->onTouchCancel(index);
+				for_iter (j, i + 1, last + 1)
+				{
+					Object::_inputChildren[j]->onTouchCancel(index);
+				}
+				this->_popInputChildren(first);
+				return true;
 			}
-			return true;
 		}
+		this->_popInputChildren(first);
 		return this->_touchUp(index);
 	}
 
@@ -1629,12 +1994,13 @@ namespace aprilui
 
 	bool Object::onTouchCancel(int index)
 	{
-		harray<Object*> objects = this->childrenObjects;
+		int first = this->_pushInputChildren();
 		this->_touchCancel(index); // _touchCancel() is the only one that is first called on this object and then on all children afterwards
-		foreach_r (Object*, it, objects)
+		for_iter_r (i, Object::_inputChildren.size(), first)
 		{
-			(*it)->onTouchCancel(index);
+			Object::_inputChildren[i]->onTouchCancel(index);
 		}
+		this->_popInputChildren(first);
 		return false;
 	}
 
@@ -1644,19 +2010,21 @@ namespace aprilui
 
 	bool Object::onTouchMove(int index)
 	{
-		if (!this->isVisible() || !this->isDerivedEnabled())
+		if (!this->isVisible() || !this->_isInputEnabled())
 		{
 			return false;
 		}
-		// needs to be copied in case children gets changed
-		harray<Object*> objects = this->childrenObjects;
-		foreach_r (Object*, it, objects)
+		// children are copied in case they get changed
+		int first = this->_pushInputChildren();
+		for_iter_r (i, Object::_inputChildren.size(), first)
 		{
-			if ((*it)->onTouchMove(index))
+			if (Object::_inputChildren[i]->onTouchMove(index))
 			{
+				this->_popInputChildren(first);
 				return true;
 			}
 		}
+		this->_popInputChildren(first);
 		return this->_touchMove(index);
 	}
 
@@ -1667,19 +2035,21 @@ namespace aprilui
 
 	bool Object::onTouch(const harray<gvec2f>& touches)
 	{
-		if (!this->isVisible() || !this->isDerivedEnabled())
+		if (!this->isVisible() || !this->_isInputEnabled())
 		{
 			return false;
 		}
-		// needs to be copied in case children gets changed
-		harray<Object*> objects = this->childrenObjects;
-		foreach_r (Object*, it, objects)
+		// children are copied in case they get changed
+		int first = this->_pushInputChildren();
+		for_iter_r (i, Object::_inputChildren.size(), first)
 		{
-			if ((*it)->onTouch(touches))
+			if (Object::_inputChildren[i]->onTouch(touches))
 			{
+				this->_popInputChildren(first);
 				return true;
 			}
 		}
+		this->_popInputChildren(first);
 		return this->_touch(touches);
 	}
 
@@ -1690,19 +2060,21 @@ namespace aprilui
 
 	bool Object::onButtonDown(april::Button buttonCode)
 	{
-		if (!this->isVisible() || !this->isDerivedEnabled())
+		if (!this->isVisible() || !this->_isInputEnabled())
 		{
 			return false;
 		}
-		// needs to be copied in case children gets changed
-		harray<Object*> objects = this->childrenObjects;
-		foreach_r (Object*, it, objects)
+		// children are copied in case they get changed
+		int first = this->_pushInputChildren();
+		for_iter_r (i, Object::_inputChildren.size(), first)
 		{
-			if ((*it)->onButtonDown(buttonCode))
+			if (Object::_inputChildren[i]->onButtonDown(buttonCode))
 			{
+				this->_popInputChildren(first);
 				return true;
 			}
 		}
+		this->_popInputChildren(first);
 		return this->_buttonDown(buttonCode);
 	}
 
@@ -1713,19 +2085,21 @@ namespace aprilui
 
 	bool Object::onButtonUp(april::Button buttonCode)
 	{
-		if (!this->isVisible() || !this->isDerivedEnabled())
+		if (!this->isVisible() || !this->_isInputEnabled())
 		{
 			return false;
 		}
-		// needs to be copied in case children gets changed
-		harray<Object*> objects = this->childrenObjects;
-		foreach_r (Object*, it, objects)
+		// children are copied in case they get changed
+		int first = this->_pushInputChildren();
+		for_iter_r (i, Object::_inputChildren.size(), first)
 		{
-			if ((*it)->onButtonUp(buttonCode))
+			if (Object::_inputChildren[i]->onButtonUp(buttonCode))
 			{
+				this->_popInputChildren(first);
 				return true;
 			}
 		}
+		this->_popInputChildren(first);
 		return this->_buttonUp(buttonCode);
 	}
 
@@ -154,7 +154,12 @@ namespace aprilui
 		}
 		if (previousHovered != this->hovered)
 		{
-			this->triggerEvent(this->hovered ? Event::HoverStarted : Event::HoverFinished);
+			Dataset* dataset = this->getDataset();
+			if (dataset != NULL)
+			{
+				dataset->requestRedraw(thisObject);
+			}
+			this->triggerEvent(this->hovered ? Event::HoverStartedId : Event::HoverFinishedId);
 		}
 	}
 
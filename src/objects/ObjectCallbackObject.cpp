@@ -34,6 +34,24 @@ namespace aprilui
 		return new CallbackObject(name);
 	}
 
+	void CallbackObject::setDrawCallback(void (*value)(CallbackObject*))
+	{
+		if (this->drawCallback != value)
+		{
+			this->drawCallback = value;
+			this->_requestRedraw();
+		}
+	}
+
+	void CallbackObject::setUpdateCallback(void (*value)(float))
+	{
+		if (this->updateCallback != value)
+		{
+			this->updateCallback = value;
+			this->_requestUpdate();
+		}
+	}
+
 	void CallbackObject::_draw()
 	{
 		if (this->drawCallback != NULL)
@@ -47,6 +65,12 @@ namespace aprilui
 		if (this->updateCallback != NULL)
 		{
 			(*this->updateCallback)(timeDelta);
+			// the callbacks are opaque so anything they do could change every frame
+			this->_requestUpdate();
+			if (this->drawCallback != NULL)
+			{
+				this->_requestRedraw();
+			}
 		}
 		Object::_update(timeDelta);
 	}
@@ -122,6 +122,7 @@ namespace aprilui
 	{
 		this->colorTopRight = value;
 		this->useAdditionalColors = true;
+		this->_requestRedraw();
 	}
 
 	void Colored::setSymbolicColorTopRight(chstr value)
@@ -129,10 +130,47 @@ namespace aprilui
 		this->setColorTopRight(aprilui::_makeColor(value));
 	}
 
+	void Colored::setRedTopRight(const unsigned char& value)
+	{
+		if (this->colorTopRight.r != value)
+		{
+			this->colorTopRight.r = value;
+			this->_requestRedraw();
+		}
+	}
+
+	void Colored::setGreenTopRight(const unsigned char& value)
+	{
+		if (this->colorTopRight.g != value)
+		{
+			this->colorTopRight.g = value;
+			this->_requestRedraw();
+		}
+	}
+
+	void Colored::setBlueTopRight(const unsigned char& value)
+	{
+		if (this->colorTopRight.b != value)
+		{
+			this->colorTopRight.b = value;
+			this->_requestRedraw();
+		}
+	}
+
+	void Colored::setAlphaTopRight(const unsigned char& value)
+	{
+		if (this->colorTopRight.a != value)
+		{
+			this->colorTopRight.a = value;
+			this->_requestRedraw();
+		}
+	}
+
 	void Colored::setColorBottomLeft(const april::Color& value)
 	{
 		this->colorBottomLeft = value;
 		this->useAdditionalColors = true;
+		this->_requestRedraw();
 	}
 
 	void Colored::setSymbolicColorBottomLeft(chstr value)
@@ -140,10 +178,47 @@ namespace aprilui
 		this->setColorBottomLeft(aprilui::_makeColor(value));
 	}
 
+	void Colored::setRedBottomLeft(const unsigned char& value)
+	{
+		if (this->colorBottomLeft.r != value)
+		{
+			this->colorBottomLeft.r = value;
+			this->_requestRedraw();
+		}
+	}
+
+	void Colored::setGreenBottomLeft(const unsigned char& value)
+	{
+		if (this->colorBottomLeft.g != value)
+		{
+			this->colorBottomLeft.g = value;
+			this->_requestRedraw();
+		}
+	}
+
+	void Colored::setBlueBottomLeft(const unsigned char& value)
+	{
+		if (this->colorBottomLeft.b != value)
+		{
+			this->colorBottomLeft.b = value;
+			this->_requestRedraw();
+		}
+	}
+
+	void Colored::setAlphaBottomLeft(const unsigned char& value)
+	{
+		if (this->colorBottomLeft.a != value)
+		{
+			this->colorBottomLeft.a = value;
+			this->_requestRedraw();
+		}
+	}
+
 	void Colored::setColorBottomRight(const april::Color& value)
 	{
 		this->colorBottomRight = value;
 		this->useAdditionalColors = true;
+		this->_requestRedraw();
 	}
 
 	void Colored::setSymbolicColorBottomRight(chstr value)
@@ -151,4 +226,44 @@ namespace aprilui
 		this->setColorBottomRight(aprilui::_makeColor(value));
 	}
 
+	void Colored::setRedBottomRight(const unsigned char& value)
+	{
+		if (this->colorBottomRight.r != value)
+		{
+			this->colorBottomRight.r = value;
+			this->_requestRedraw();
+		}
+	}
+	void Colored::setGreenBottomRight(const unsigned char& value)
+	{
+		if (this->colorBottomRight.g != value)
+		{
+			this->colorBottomRight.g = value;
+			this->_requestRedraw();
+		}
+	}
+	void Colored::setBlueBottomRight(const unsigned char& value)
+	{
+		if (this->colorBottomRight.b != value)
+		{
+			this->colorBottomRight.b = value;
+			this->_requestRedraw();
+		}
+	}
+	void Colored::setAlphaBottomRight(const unsigned char& value)
+	{
+		if (this->colorBottomRight.a != value)
+		{
+			this->colorBottomRight.a = value;
+			this->_requestRedraw();
+		}
+	}
+	void Colored::setUseAdditionalColors(const bool& value)
+	{
+		if (this->useAdditionalColors != value)
+		{
+			this->useAdditionalColors = value;
+			this->_requestRedraw();
+		}
+	}
 }
@@ -40,10 +40,10 @@ namespace aprilui
 		return new Container(name);
 	}
 
-	void Container::notifyEvent(chstr type, EventArgs* args)
+	void Container::_notifyEvent(int typeId, EventArgs* args)
 	{
-		Object::notifyEvent(type, args);
-		if (type == Event::SizeChanged)
+		Object::_notifyEvent(typeId, args);
+		if (typeId == Event::SizeChangedId)
 		{
 			if (this->scrollArea != NULL)
 			{
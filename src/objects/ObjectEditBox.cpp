@@ -239,6 +239,12 @@ namespace aprilui
 		return Label::isCursorInside();
 	}
 
+	int64_t EditBox::getByteSize() const
+	{
+		return (Label::getByteSize() + (int64_t)(sizeof(EditBox) - sizeof(Label) + this->emptyText.size() + this->emptyTextKey.size() +
+			this->passwordChar.size() + this->filter.size()));
+	}
+
 	void EditBox::setEmptyText(chstr value)
 	{
 		this->emptyText = value;
@@ -252,6 +258,15 @@ namespace aprilui
 		this->emptyTextKey = emptyTextKey;
 	}
 
+	void EditBox::setEmptyTextColor(const april::Color& value)
+	{
+		if (this->emptyTextColor != value)
+		{
+			this->emptyTextColor = value;
+			this->_requestRedraw();
+		}
+	}
+
 	void EditBox::setEmptyTextSymbolicColor(chstr value)
 	{
 		this->setEmptyTextColor(aprilui::_makeColor(value));
@@ -269,11 +284,29 @@ namespace aprilui
 		this->_blinkTimer = 0.0f;
 	}
 
+	void EditBox::setCaretColor(const april::Color& value)
+	{
+		if (this->caretColor != value)
+		{
+			this->caretColor = value;
+			this->_requestRedraw();
+		}
+	}
+
 	void EditBox::setCaretSymbolicColor(chstr value)
 	{
 		this->setCaretColor(aprilui::_makeColor(value));
 	}
 
+	void EditBox::setMultiLine(const bool& value)
+	{
+		if (this->multiLine != value)
+		{
+			this->multiLine = value;
+			this->_requestRedraw();
+		}
+	}
+
 	void EditBox::setSelectionCount(const int& value)
 	{
 		int newSelectionCount = (this->selectable ? hclamp(value, -this->caretIndex, this->text.utf8Size() - this->caretIndex) : 0);
@@ -284,11 +317,38 @@ namespace aprilui
 		}
 	}
 
+	void EditBox::setSelectionColor(const april::Color& value)
+	{
+		if (this->selectionColor != value)
+		{
+			this->selectionColor = value;
+			this->_requestRedraw();
+		}
+	}
+
 	void EditBox::setSelectionSymbolicColor(chstr value)
 	{
 		this->setSelectionColor(aprilui::_makeColor(value));
 	}
 
+	void EditBox::setPasswordChar(chstr value)
+	{
+		if (this->passwordChar != value)
+		{
+			this->passwordChar = value;
+			this->_requestRedraw();
+		}
+	}
+
+	void EditBox::setDisabledOffset(const bool& value)
+	{
+		if (this->disabledOffset != value)
+		{
+			this->disabledOffset = value;
+			this->_requestRedraw();
+		}
+	}
+
 	void EditBox::setMaxLength(const int& value)
 	{
 		this->maxLength = value;
@@ -374,15 +434,29 @@ namespace aprilui
 	void EditBox::_update(float time)
 	{
 		Label::_update(time);
+		if (this->pushed || this->isFocused())
+		{
+			// the caret blinks and the selection follows the cursor
+			this->_requestUpdate();
+		}
 		if (!this->pushed)
 		{
+			bool caretVisible = (this->_blinkTimer < 0.5f);
 			this->_blinkTimer += time * 2;
 			this->_blinkTimer = (this->_blinkTimer - (int)this->_blinkTimer);
+			if (this->dataset != NULL && caretVisible != (this->_blinkTimer < 0.5f) && this->isFocused())
+			{
+				this->dataset->requestRedraw(this);
+			}
 			this->_updateCaretPosition();
 			this->_updateCaret();
 			this->_updateSelection();
 			return;
 		}
+		if (this->dataset != NULL)
+		{
+			this->dataset->requestRedraw(this);
+		}
 		int index = this->caretIndex;
 		this->setCaretIndexAt(this->transformToLocalSpace(aprilui::getCursorPosition()));
 		this->_updateCaretPosition();
@@ -842,25 +916,26 @@ namespace aprilui
 		this->textColor = textColor;
 	}
 
-	void EditBox::notifyEvent(chstr type, EventArgs* args)
+	void EditBox::_notifyEvent(int typeId, EventArgs* args)
 	{
-		if (type == Event::LocalizationChanged)
+		switch (typeId)
 		{
+		case Event::LocalizationChangedId:
 			if (this->emptyTextKey != "")
 			{
 				this->setEmptyTextKey(this->emptyTextKey);
 			}
-		}
-		else if (type == Event::FocusGained)
-		{
+			break;
+		case Event::FocusGainedId:
 			// some OSes will disable the keyboard if it is shown before a mouse-up event
 			// Controller input mode needs to explicitly show the keyboard
 			if (!this->pushed && april::window->getInputMode() != april::InputMode::Controller)
 			{
 				april::window->showVirtualKeyboard();
 			}
+			break;
 		}
-		Label::notifyEvent(type, args);
+		Label::_notifyEvent(typeId, args);
 	}
 
 	bool EditBox::triggerEvent(chstr type, april::Key keyCode)
@@ -893,6 +968,36 @@ namespace aprilui
 		return Label::triggerEvent(type, userData);
 	}
 
+	bool EditBox::triggerEvent(int typeId, april::Key keyCode)
+	{
+		return Label::triggerEvent(typeId, keyCode);
+	}
+
+	bool EditBox::triggerEvent(int typeId, april::Key keyCode, chstr string)
+	{
+		return Label::triggerEvent(typeId, keyCode, string);
+	}
+
+	bool EditBox::triggerEvent(int typeId, april::Key keyCode, cgvec2f position, chstr string, void* userData)
+	{
+		return Label::triggerEvent(typeId, keyCode, position, string, userData);
+	}
+
+	bool EditBox::triggerEvent(int typeId, april::Button buttonCode, chstr string, void* userData)
+	{
+		return Label::triggerEvent(typeId, buttonCode, string, userData);
+	}
+
+	bool EditBox::triggerEvent(int typeId, chstr string, void* userData)
+	{
+		return Label::triggerEvent(typeId, string, userData);
+	}
+
+	bool EditBox::triggerEvent(int typeId, void* userData)
+	{
+		return Label::triggerEvent(typeId, userData);
+	}
+
 	bool EditBox::_mouseDown(april::Key keyCode)
 	{
 		bool result = ButtonBase::_mouseDown(keyCode);
@@ -904,7 +1009,7 @@ namespace aprilui
 			this->_updateCaretPosition();
 			this->_updateCaret();
 			this->_updateSelection();
-			this->triggerEvent(Event::MouseDown, keyCode);
+			this->triggerEvent(Event::MouseDownId, keyCode);
 		}
 		else
 		{
@@ -919,7 +1024,7 @@ namespace aprilui
 		bool up = false;
 		if (this->hovered)
 		{
-			up = this->triggerEvent(Event::MouseUp, keyCode);
+			up = this->triggerEvent(Event::MouseUpId, keyCode);
 		}
 		if (result)
 		{
@@ -928,7 +1033,7 @@ namespace aprilui
 				// some OSes will disable the keyboard if it is shown before a mouse-up event
 				april::window->showVirtualKeyboard();
 			}
-			this->triggerEvent(Event::Click, keyCode);
+			this->triggerEvent(Event::ClickId, keyCode);
 		}
 		return (result || up || Label::_mouseUp(keyCode));
 	}
@@ -944,6 +1049,11 @@ namespace aprilui
 		return (ButtonBase::_mouseMove() || Label::_mouseMove());
 	}
 
+	bool EditBox::_isTrackingPointer() const
+	{
+		return (this->hovered || this->pushed);
+	}
+
 	bool EditBox::_keyDown(april::Key keyCode)
 	{
 		if (this->dataset == NULL || this->dataset->getFocusedObject() == this)
@@ -1072,7 +1182,7 @@ namespace aprilui
 				{
 					this->_insertChar('\n');
 				}
-				this->triggerEvent(Event::SubmitEditText, april::Key::Return);
+				this->triggerEvent(Event::SubmitEditTextId, april::Key::Return);
 				return true;
 			}
 		}
@@ -1121,7 +1231,7 @@ namespace aprilui
 		bool result = ButtonBase::_buttonDown(buttonCode);
 		if (result)
 		{
-			this->triggerEvent(Event::ButtonDown, buttonCode);
+			this->triggerEvent(Event::ButtonDownId, buttonCode);
 		}
 		return (result || Label::_buttonDown(buttonCode));
 	}
@@ -1136,7 +1246,7 @@ namespace aprilui
 		bool up = false;
 		if (this->hovered)
 		{
-			up = this->triggerEvent(Event::ButtonUp, buttonCode);
+			up = this->triggerEvent(Event::ButtonUpId, buttonCode);
 		}
 		if (result)
 		{
@@ -1145,7 +1255,7 @@ namespace aprilui
 			{
 				april::window->showVirtualKeyboard();
 			}
-			this->triggerEvent(Event::ButtonTrigger, buttonCode);
+			this->triggerEvent(Event::ButtonTriggerId, buttonCode);
 		}
 		return (result || up || Label::_buttonUp(buttonCode));
 	}
@@ -1318,7 +1428,7 @@ namespace aprilui
 			this->text = left + right;
 			this->_blinkTimer = 0.0f;
 			this->setCaretIndex(newCaretIndex);
-			this->triggerEvent(Event::TextChanged);
+			this->triggerEvent(Event::TextChangedId);
 		}
 		this->setSelectionCount(0);
 	}
@@ -1427,7 +1537,7 @@ namespace aprilui
 		}
 		this->text = (left + hstr::fromUnicode(charCode)) + right;
 		this->setCaretIndex(this->caretIndex + 1);
-		this->triggerEvent(Event::TextChanged);
+		this->triggerEvent(Event::TextChangedId);
 	}
 
 	void EditBox::_cutText()
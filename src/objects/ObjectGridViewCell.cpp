@@ -177,10 +177,10 @@ namespace aprilui
 		}
 	}
 
-	void GridViewCell::notifyEvent(chstr type, EventArgs* args)
+	void GridViewCell::_notifyEvent(int typeId, EventArgs* args)
 	{
-		Container::notifyEvent(type, args);
-		if (type == Event::AttachedToObject)
+		Container::_notifyEvent(typeId, args);
+		if (typeId == Event::AttachedToObjectId)
 		{
 			GridViewRow* gridViewRow = dynamic_cast<GridViewRow*>(this->parent);
 			if (gridViewRow != NULL)
@@ -238,12 +238,42 @@ namespace aprilui
 		return Container::triggerEvent(type, userData);
 	}
 
+	bool GridViewCell::triggerEvent(int typeId, april::Key keyCode)
+	{
+		return Container::triggerEvent(typeId, keyCode);
+	}
+
+	bool GridViewCell::triggerEvent(int typeId, april::Key keyCode, chstr string)
+	{
+		return Container::triggerEvent(typeId, keyCode, string);
+	}
+
+	bool GridViewCell::triggerEvent(int typeId, april::Key keyCode, cgvec2f position, chstr string, void* userData)
+	{
+		return Container::triggerEvent(typeId, keyCode, position, string, userData);
+	}
+
+	bool GridViewCell::triggerEvent(int typeId, april::Button buttonCode, chstr string, void* userData)
+	{
+		return Container::triggerEvent(typeId, buttonCode, string, userData);
+	}
+
+	bool GridViewCell::triggerEvent(int typeId, chstr string, void* userData)
+	{
+		return Container::triggerEvent(typeId, string, userData);
+	}
+
+	bool GridViewCell::triggerEvent(int typeId, void* userData)
+	{
+		return Container::triggerEvent(typeId, userData);
+	}
+
 	bool GridViewCell::_mouseDown(april::Key keyCode)
 	{
 		bool result = ButtonBase::_mouseDown(keyCode);
 		if (result)
 		{
-			this->triggerEvent(Event::MouseDown, keyCode);
+			this->triggerEvent(Event::MouseDownId, keyCode);
 		}
 		return (result || Container::_mouseDown(keyCode));
 	}
@@ -254,12 +284,12 @@ namespace aprilui
 		bool up = false;
 		if (this->hovered)
 		{
-			up = this->triggerEvent(Event::MouseUp, keyCode);
+			up = this->triggerEvent(Event::MouseUpId, keyCode);
 		}
 		if (result)
 		{
 			this->_setSelected();
-			this->triggerEvent(Event::Click, keyCode);
+			this->triggerEvent(Event::ClickId, keyCode);
 		}
 		return (result || up || Container::_mouseUp(keyCode));
 	}
@@ -275,12 +305,17 @@ namespace aprilui
 		return (ButtonBase::_mouseMove() || Container::_mouseMove());
 	}
 
+	bool GridViewCell::_isTrackingPointer() const
+	{
+		return (this->hovered || this->pushed);
+	}
+
 	bool GridViewCell::_touchDown(int index)
 	{
 		bool result = ButtonBase::_touchDown(index);
 		if (result)
 		{
-			this->triggerEvent(Event::TouchDown, april::Key::None, hstr(index));
+			this->triggerEvent(Event::TouchDownId, april::Key::None, hstr(index));
 		}
 		return (result || Container::_touchDown(index));
 	}
@@ -292,10 +327,10 @@ namespace aprilui
 		bool up = false;
 		if (released)
 		{
-			up = this->triggerEvent(Event::TouchUp, april::Key::None, hstr(index));
+			up = this->triggerEvent(Event::TouchUpId, april::Key::None, hstr(index));
 			if (result)
 			{
-				this->triggerEvent(Event::Tap, april::Key::None, hstr(index));
+				this->triggerEvent(Event::TapId, april::Key::None, hstr(index));
 			}
 		}
 		return (result || up || Container::_touchUp(index));
@@ -317,7 +352,7 @@ namespace aprilui
 		bool result = ButtonBase::_buttonDown(buttonCode);
 		if (result)
 		{
-			this->triggerEvent(Event::ButtonDown, buttonCode);
+			this->triggerEvent(Event::ButtonDownId, buttonCode);
 		}
 		return (result || Container::_buttonDown(buttonCode));
 	}
@@ -332,12 +367,12 @@ namespace aprilui
 		bool up = false;
 		if (this->hovered)
 		{
-			up = this->triggerEvent(Event::ButtonUp, buttonCode);
+			up = this->triggerEvent(Event::ButtonUpId, buttonCode);
 		}
 		if (result)
 		{
 			this->_setSelected();
-			this->triggerEvent(Event::ButtonTrigger, buttonCode);
+			this->triggerEvent(Event::ButtonTriggerId, buttonCode);
 		}
 		return (result || up || Container::_buttonUp(buttonCode));
 	}
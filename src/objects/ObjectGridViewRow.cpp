@@ -34,10 +34,10 @@ namespace aprilui
 		return new GridViewRow(name);
 	}
 
-	void GridViewRow::notifyEvent(chstr type, EventArgs* args)
+	void GridViewRow::_notifyEvent(int typeId, EventArgs* args)
 	{
-		Container::notifyEvent(type, args);
-		if (type == Event::AttachedToObject)
+		Container::_notifyEvent(typeId, args);
+		if (typeId == Event::AttachedToObjectId)
 		{
 			GridView* gridView = dynamic_cast<GridView*>(this->parent);
 			if (gridView != NULL)
@@ -67,10 +67,10 @@ namespace aprilui
 		return row;
 	}
 
-	void GridViewRowTemplate::notifyEvent(chstr type, EventArgs* args)
+	void GridViewRowTemplate::_notifyEvent(int typeId, EventArgs* args)
 	{
-		Container::notifyEvent(type, args); // overrides GridViewRow's default events
-		if (type == Event::AttachedToObject)
+		Container::_notifyEvent(typeId, args); // overrides GridViewRow's default events
+		if (typeId == Event::AttachedToObjectId)
 		{
 			GridView* gridView = dynamic_cast<GridView*>(this->parent);
 			if (gridView != NULL)
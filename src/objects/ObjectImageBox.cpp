@@ -75,6 +75,10 @@ namespace aprilui
 
 	void ImageBox::setImage(BaseImage* image)
 	{
+		if (this->image != image)
+		{
+			this->_requestRedraw();
+		}
 		this->image = image;
 		if (image != NULL)
 		{
@@ -90,6 +94,7 @@ namespace aprilui
 				this->rect.h = size.y;
 				this->pivot.y = size.y * 0.5f;
 			}
+			this->_invalidateDrawList();
 			this->imageName = image->getFullName();
 		}
 		else
@@ -99,6 +104,33 @@ namespace aprilui
 		}
 	}
 
+	void ImageBox::setTileScroll(cgvec2f value)
+	{
+		if (this->tileScroll != value)
+		{
+			this->tileScroll = value;
+			this->_requestRedraw();
+		}
+	}
+
+	void ImageBox::setTileScrollX(const float& value)
+	{
+		if (this->tileScroll.x != value)
+		{
+			this->tileScroll.x = value;
+			this->_requestRedraw();
+		}
+	}
+
+	void ImageBox::setTileScrollY(const float& value)
+	{
+		if (this->tileScroll.y != value)
+		{
+			this->tileScroll.y = value;
+			this->_requestRedraw();
+		}
+	}
+
 	void ImageBox::setImageByName(chstr name)
 	{
 		if (this->dataset != NULL)
@@ -355,13 +355,13 @@ namespace aprilui
 		}
 	}
 	
-	void ImageButton::notifyEvent(chstr type, EventArgs* args)
+	void ImageButton::_notifyEvent(int typeId, EventArgs* args)
 	{
-		if (type == Event::EnabledChanged)
+		if (typeId == Event::EnabledChangedId)
 		{
 			this->_updateImage();
 		}
-		ImageBox::notifyEvent(type, args);
+		ImageBox::_notifyEvent(typeId, args);
 	}
 
 	bool ImageButton::triggerEvent(chstr type, april::Key keyCode)
@@ -394,12 +394,42 @@ namespace aprilui
 		return ImageBox::triggerEvent(type, userData);
 	}
 
+	bool ImageButton::triggerEvent(int typeId, april::Key keyCode)
+	{
+		return ImageBox::triggerEvent(typeId, keyCode);
+	}
+
+	bool ImageButton::triggerEvent(int typeId, april::Key keyCode, chstr string)
+	{
+		return ImageBox::triggerEvent(typeId, keyCode, string);
+	}
+
+	bool ImageButton::triggerEvent(int typeId, april::Key keyCode, cgvec2f position, chstr string, void* userData)
+	{
+		return ImageBox::triggerEvent(typeId, keyCode, position, string, userData);
+	}
+
+	bool ImageButton::triggerEvent(int typeId, april::Button buttonCode, chstr string, void* userData)
+	{
+		return ImageBox::triggerEvent(typeId, buttonCode, string, userData);
+	}
+
+	bool ImageButton::triggerEvent(int typeId, chstr string, void* userData)
+	{
+		return ImageBox::triggerEvent(typeId, string, userData);
+	}
+
+	bool ImageButton::triggerEvent(int typeId, void* userData)
+	{
+		return ImageBox::triggerEvent(typeId, userData);
+	}
+
 	bool ImageButton::_mouseDown(april::Key keyCode)
 	{
 		bool result = ButtonBase::_mouseDown(keyCode);
 		if (result)
 		{
-			this->triggerEvent(Event::MouseDown, keyCode);
+			this->triggerEvent(Event::MouseDownId, keyCode);
 		}
 		return (result || ImageBox::_mouseDown(keyCode));
 	}
@@ -410,11 +440,11 @@ namespace aprilui
 		bool up = false;
 		if (this->hovered)
 		{
-			up = this->triggerEvent(Event::MouseUp, keyCode);
+			up = this->triggerEvent(Event::MouseUpId, keyCode);
 		}
 		if (result)
 		{
-			this->triggerEvent(Event::Click, keyCode);
+			this->triggerEvent(Event::ClickId, keyCode);
 		}
 		return (result || up || ImageBox::_mouseUp(keyCode));
 	}
@@ -430,17 +460,22 @@ namespace aprilui
 		bool result = (ButtonBase::_mouseMove() || ImageBox::_mouseMove());
 		if (this->pushed)
 		{
-			this->triggerEvent(Event::MouseMove);
+			this->triggerEvent(Event::MouseMoveId);
 		}
 		return result;
 	}
 
+	bool ImageButton::_isTrackingPointer() const
+	{
+		return (this->hovered || this->pushed);
+	}
+
 	bool ImageButton::_touchDown(int index)
 	{
 		bool result = ButtonBase::_touchDown(index);
 		if (result)
 		{
-			this->triggerEvent(Event::TouchDown, april::Key::None, hstr(index));
+			this->triggerEvent(Event::TouchDownId, april::Key::None, hstr(index));
 		}
 		return (result || ImageBox::_touchDown(index));
 	}
@@ -451,10 +486,10 @@ namespace aprilui
 		bool released = ButtonBase::_touchUp(index);
 		if (released)
 		{
-			this->triggerEvent(Event::TouchUp, april::Key::None, hstr(index));
+			this->triggerEvent(Event::TouchUpId, april::Key::None, hstr(index));
 			if (result)
 			{
-				this->triggerEvent(Event::Tap, april::Key::None, hstr(index));
+				this->triggerEvent(Event::TapId, april::Key::None, hstr(index));
 			}
 		}
 		return (result || released || ImageBox::_touchUp(index));
@@ -471,7 +506,7 @@ namespace aprilui
 		bool result = (ButtonBase::_touchMove(index) || ImageBox::_touchMove(index));
 		if (this->touched.has(index))
 		{
-			this->triggerEvent(Event::TouchMove, april::Key::None, hstr(index));
+			this->triggerEvent(Event::TouchMoveId, april::Key::None, hstr(index));
 		}
 		return result;
 	}
@@ -481,7 +516,7 @@ namespace aprilui
 		bool result = ButtonBase::_buttonDown(buttonCode);
 		if (result)
 		{
-			this->triggerEvent(Event::ButtonDown, buttonCode);
+			this->triggerEvent(Event::ButtonDownId, buttonCode);
 		}
 		return (result || ImageBox::_buttonDown(buttonCode));
 	}
@@ -496,11 +531,11 @@ namespace aprilui
 		bool up = false;
 		if (this->hovered)
 		{
-			up = this->triggerEvent(Event::ButtonUp, buttonCode);
+			up = this->triggerEvent(Event::ButtonUpId, buttonCode);
 		}
 		if (result)
 		{
-			this->triggerEvent(Event::ButtonTrigger, buttonCode);
+			this->triggerEvent(Event::ButtonTriggerId, buttonCode);
 		}
 		return (result || up || ImageBox::_buttonUp(buttonCode));
 	}
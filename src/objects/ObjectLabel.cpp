@@ -12,6 +12,7 @@
 
 #include "aprilui.h"
 #include "Dataset.h"
+#include "Event.h"
 #include "ObjectLabel.h"
 
 namespace aprilui
@@ -25,6 +26,7 @@ namespace aprilui
 		LabelBase()
 	{
 		this->text = "Label: " + name;
+		this->subscribeBroadcast(Event::LocalizationChanged);
 		this->debugColor.set(april::Color::Aqua, 32);
 	}
 
@@ -77,6 +79,11 @@ namespace aprilui
 		return this->autoScaledFont;
 	}
 
+	int64_t Label::getByteSize() const
+	{
+		return (Object::getByteSize() + LabelBase::getByteSize() + (int64_t)(sizeof(Label) - sizeof(Object) - sizeof(LabelBase)));
+	}
+
 	void Label::_draw()
 	{
 		Object::_draw();
@@ -86,6 +93,12 @@ namespace aprilui
 		this->_drawLabel(drawRect, drawColor);
 	}
 
+	grectf Label::_makeDrawBounds()
+	{
+		this->_textDrawBounds = this->_makeTextDrawBounds(Object::_makeDrawBounds());
+		return this->_textDrawBounds;
+	}
+
 	hstr Label::getProperty(chstr name)
 	{
 		hstr result = LabelBase::getProperty(name); // check side-class first
@@ -105,10 +118,10 @@ namespace aprilui
 		return Object::setProperty(name, value);
 	}
 
-	void Label::notifyEvent(chstr type, EventArgs* args)
+	void Label::_notifyEvent(int typeId, EventArgs* args)
 	{
-		Object::notifyEvent(type, args);
-		LabelBase::notifyEvent(type, args);
+		Object::_notifyEvent(typeId, args);
+		LabelBase::_notifyEvent(typeId, args);
 	}
 
 	bool Label::triggerEvent(chstr type, april::Key keyCode)
@@ -141,4 +154,34 @@ namespace aprilui
 		return Object::triggerEvent(type, userData);
 	}
 
+	bool Label::triggerEvent(int typeId, april::Key keyCode)
+	{
+		return Object::triggerEvent(typeId, keyCode);
+	}
+
+	bool Label::triggerEvent(int typeId, april::Key keyCode, chstr string)
+	{
+		return Object::triggerEvent(typeId, keyCode, string);
+	}
+
+	bool Label::triggerEvent(int typeId, april::Key keyCode, cgvec2f position, chstr string, void* userData)
+	{
+		return Object::triggerEvent(typeId, keyCode, position, string, userData);
+	}
+
+	bool Label::triggerEvent(int typeId, april::Button buttonCode, chstr string, void* userData)
+	{
+		return Object::triggerEvent(typeId, buttonCode, string, userData);
+	}
+
+	bool Label::triggerEvent(int typeId, chstr string, void* userData)
+	{
+		return Object::triggerEvent(typeId, string, userData);
+	}
+
+	bool Label::triggerEvent(int typeId, void* userData)
+	{
+		return Object::triggerEvent(typeId, userData);
+	}
+
 }
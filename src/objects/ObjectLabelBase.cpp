@@ -21,6 +21,7 @@
 #include "apriluiUtil.h"
 #include "Dataset.h"
 #include "Exception.h"
+#include "Object.h"
 #include "ObjectLabelBase.h"
 
 #define MAX_AUTO_SCALE_STEPS 5
@@ -69,6 +70,7 @@ namespace aprilui
 		this->backgroundColor = april::Color::Clear;
 		this->backgroundBorder = true;
 		this->_autoScaleDirty = true;
+		this->_textDrawBounds.set(0.0f, 0.0f, 0.0f, 0.0f);
 	}
 
 	LabelBase::LabelBase(const LabelBase& other)
@@ -102,12 +104,19 @@ namespace aprilui
 		this->backgroundColor = other.backgroundColor;
 		this->backgroundBorder = other.backgroundBorder;
 		this->_autoScaleDirty = true;
+		this->_textDrawBounds.set(0.0f, 0.0f, 0.0f, 0.0f);
 	}
 
 	LabelBase::~LabelBase()
 	{
 	}
 
+	int64_t LabelBase::getByteSize() const
+	{
+		return (int64_t)(sizeof(LabelBase) + this->text.size() + this->textKey.size() + this->font.size() + this->autoScaledFont.size() +
+			this->effectParameter.size() + this->strikeThroughParameter.size() + this->underlineParameter.size());
+	}
+
 	hmap<hstr, PropertyDescription>& LabelBase::getPropertyDescriptions() const
 	{
 		if (LabelBase::_propertyDescriptions.size() == 0)
@@ -142,8 +151,9 @@ namespace aprilui
 		this->textKey = "";
 		if (changed)
 		{
-			this->triggerEvent(Event::TextChanged);
+			this->triggerEvent(Event::TextChangedId);
 			this->_autoScaleDirty = true;
+			this->_requestTextRedraw();
 		}
 	}
 
@@ -155,7 +165,7 @@ namespace aprilui
 		this->textKey = newTextKey;
 		if (changed)
 		{
-			this->triggerEvent(Event::TextKeyChanged);
+			this->triggerEvent(Event::TextKeyChangedId);
 			this->_autoScaleDirty = true;
 		}
 	}
@@ -166,6 +176,26 @@ namespace aprilui
 		{
 			this->font = value;
 			this->_autoScaleDirty = true;
+			this->_requestTextRedraw();
+		}
+	}
+
+	void LabelBase::setTextFormatting(const bool& value)
+	{
+		if (this->textFormatting != value)
+		{
+			this->textFormatting = value;
+			this->_autoScaleDirty = true;
+			this->_requestTextRedraw();
+		}
+	}
+
+	void LabelBase::setTextColor(const april::Color& value)
+	{
+		if (this->textColor != value)
+		{
+			this->textColor = value;
+			this->_requestTextRedraw();
 		}
 	}
 
@@ -180,6 +210,7 @@ namespace aprilui
 		{
 			this->textOffset = value;
 			this->_autoScaleDirty = true;
+			this->_requestTextRedraw();
 		}
 	}
 
@@ -189,6 +220,7 @@ namespace aprilui
 		{
 			this->textOffset.x = value;
 			this->_autoScaleDirty = true;
+			this->_requestTextRedraw();
 		}
 	}
 
@@ -198,6 +230,7 @@ namespace aprilui
 		{
 			this->textOffset.y = value;
 			this->_autoScaleDirty = true;
+			this->_requestTextRedraw();
 		}
 	}
 
@@ -208,6 +241,43 @@ namespace aprilui
 		{
 			this->minAutoScale = newValue;
 			this->_autoScaleDirty = true;
+			this->_requestTextRedraw();
+		}
+	}
+
+	void LabelBase::setEffect(const atres::TextEffect& value)
+	{
+		if (this->effect != value)
+		{
+			this->effect = value;
+			this->_requestTextRedraw();
+		}
+	}
+
+	void LabelBase::setUseEffectColor(const bool& value)
+	{
+		if (this->useEffectColor != value)
+		{
+			this->useEffectColor = value;
+			this->_requestTextRedraw();
+		}
+	}
+
+	void LabelBase::setUseEffectParameter(const bool& value)
+	{
+		if (this->useEffectParameter != value)
+		{
+			this->useEffectParameter = value;
+			this->_requestTextRedraw();
+		}
+	}
+
+	void LabelBase::setEffectColor(const april::Color& value)
+	{
+		if (this->effectColor != value)
+		{
+			this->effectColor = value;
+			this->_requestTextRedraw();
 		}
 	}
 
@@ -216,21 +286,169 @@ namespace aprilui
 		this->setEffectColor(aprilui::_makeColor(value));
 	}
 
+	void LabelBase::setEffectParameter(chstr value)
+	{
+		if (this->effectParameter != value)
+		{
+			this->effectParameter = value;
+			this->_requestTextRedraw();
+		}
+	}
+
+	void LabelBase::setBackgroundColor(const april::Color& value)
+	{
+		if (this->backgroundColor != value)
+		{
+			this->backgroundColor = value;
+			this->_requestTextRedraw();
+		}
+	}
+
 	void LabelBase::setBackgroundSymbolicColor(chstr value)
 	{
 		this->setBackgroundColor(aprilui::_makeColor(value));
 	}
 
+	void LabelBase::setStrikeThrough(const bool& value)
+	{
+		if (this->strikeThrough != value)
+		{
+			this->strikeThrough = value;
+			this->_requestTextRedraw();
+		}
+	}
+
+	void LabelBase::setUseStrikeThroughColor(const bool& value)
+	{
+		if (this->useStrikeThroughColor != value)
+		{
+			this->useStrikeThroughColor = value;
+			this->_requestTextRedraw();
+		}
+	}
+
+	void LabelBase::setUseStrikeThroughParameter(const bool& value)
+	{
+		if (this->useStrikeThroughParameter != value)
+		{
+			this->useStrikeThroughParameter = value;
+			this->_requestTextRedraw();
+		}
+	}
+
+	void LabelBase::setStrikeThroughColor(const april::Color& value)
+	{
+		if (this->strikeThroughColor != value)
+		{
+			this->strikeThroughColor = value;
+			this->_requestTextRedraw();
+		}
+	}
+
 	void LabelBase::setStrikeThroughSymbolicColor(chstr value)
 	{
 		this->setStrikeThroughColor(aprilui::_makeColor(value));
 	}
 
+	void LabelBase::setStrikeThroughParameter(chstr value)
+	{
+		if (this->strikeThroughParameter != value)
+		{
+			this->strikeThroughParameter = value;
+			this->_requestTextRedraw();
+		}
+	}
+
+	void LabelBase::setUnderline(const bool& value)
+	{
+		if (this->underline != value)
+		{
+			this->underline = value;
+			this->_requestTextRedraw();
+		}
+	}
+
+	void LabelBase::setUseUnderlineColor(const bool& value)
+	{
+		if (this->useUnderlineColor != value)
+		{
+			this->useUnderlineColor = value;
+			this->_requestTextRedraw();
+		}
+	}
+
+	void LabelBase::setUseUnderlineParameter(const bool& value)
+	{
+		if (this->useUnderlineParameter != value)
+		{
+			this->useUnderlineParameter = value;
+			this->_requestTextRedraw();
+		}
+	}
+
+	void LabelBase::setUnderlineColor(const april::Color& value)
+	{
+		if (this->underlineColor != value)
+		{
+			this->underlineColor = value;
+			this->_requestTextRedraw();
+		}
+	}
+
 	void LabelBase::setUnderlineSymbolicColor(chstr value)
 	{
 		this->setUnderlineColor(aprilui::_makeColor(value));
 	}
 
+	void LabelBase::setUnderlineParameter(chstr value)
+	{
+		if (this->underlineParameter != value)
+		{
+			this->underlineParameter = value;
+			this->_requestTextRedraw();
+		}
+	}
+
+	void LabelBase::setItalic(const bool& value)
+	{
+		if (this->italic != value)
+		{
+			this->italic = value;
+			this->_requestTextRedraw();
+		}
+	}
+
+	void LabelBase::setBackgroundBorder(const bool& value)
+	{
+		if (this->backgroundBorder != value)
+		{
+			this->backgroundBorder = value;
+			this->_requestTextRedraw();
+		}
+	}
+
+	void LabelBase::_requestTextRedraw()
+	{
+		Dataset* dataset = this->getDataset();
+		if (dataset != NULL)
+		{
+			Object* object = dynamic_cast<Object*>(this);
+			if (object != NULL && dataset->isDirtyRectRedrawing())
+			{
+				// text that now reaches past the recorded bounds cannot be redrawn within the cached bounds of the object
+				grectf bounds = this->_makeTextDrawBounds(grectf(-object->getPivot(), object->getSize()));
+				if (bounds.x < this->_textDrawBounds.x || bounds.y < this->_textDrawBounds.y ||
+					bounds.x + bounds.w > this->_textDrawBounds.x + this->_textDrawBounds.w ||
+					bounds.y + bounds.h > this->_textDrawBounds.y + this->_textDrawBounds.h)
+				{
+					dataset->requestRedraw();
+					return;
+				}
+			}
+			dataset->requestRedraw(object);
+		}
+	}
+
 	void LabelBase::_calcAutoScaledFont(cgrectf rect)
 	{
 		if (this->_autoScaleDirty)
@@ -259,6 +477,7 @@ namespace aprilui
 		{
 			this->horzFormatting = value;
 			this->_autoScaleDirty = true;
+			this->_requestTextRedraw();
 		}
 	}
 
@@ -268,6 +487,7 @@ namespace aprilui
 		{
 			this->vertFormatting = value;
 			this->_autoScaleDirty = true;
+			this->_requestTextRedraw();
 		}
 	}
 
@@ -277,6 +497,7 @@ namespace aprilui
 		{
 			this->caseMode = value;
 			this->_autoScaleDirty = true;
+			this->_requestTextRedraw();
 		}
 	}
 
@@ -287,7 +508,7 @@ namespace aprilui
 			hstr newTextKey = textKey; // because value is a chstr which could reference this->textKey itself
 			this->setText(this->getDataset()->getText(newTextKey));
 			this->textKey = newTextKey;
-			this->triggerEvent(Event::TextKeyChanged);
+			this->triggerEvent(Event::TextKeyChangedId);
 			this->_autoScaleDirty = true;
 			return true;
 		}
@@ -403,6 +624,31 @@ namespace aprilui
 		atres::renderer->drawText(font, rect, text, this->horzFormatting, this->vertFormatting, drawColor, offset);
 	}
 
+	grectf LabelBase::_makeTextDrawBounds(cgrectf rect)
+	{
+		if (this->text.size() == 0)
+		{
+			return rect;
+		}
+		hstr fontName = (this->autoScaledFont == "" ? this->font : this->autoScaledFont);
+		atres::Font* font = atres::renderer->getFont(fontName);
+		if (font == NULL)
+		{
+			return rect;
+		}
+		// text is not clipped to the rect, the overflow is added on both sides since it depends on the formatting
+		gvec2f extent;
+		if (!this->horzFormatting.isWrapped())
+		{
+			extent.x = hmax(atres::renderer->getTextWidth(fontName, this->text) - rect.w, 0.0f);
+		}
+		extent.y = hmax(atres::renderer->getTextHeight(fontName, this->text, rect.w) - rect.h, 0.0f);
+		// borders, shadows, italics and glyph overhangs are covered by a conservative margin
+		float margin = font->getLineHeight() * 0.5f;
+		extent += gvec2f(habs(this->textOffset.x) + margin, habs(this->textOffset.y) + margin);
+		return grectf(rect.getPosition() - extent, rect.getSize() + extent * 2.0f);
+	}
+
 	hstr LabelBase::getProperty(chstr name)
 	{
 		if (name == "horz_formatting")
@@ -649,19 +895,22 @@ namespace aprilui
 		return true;
 	}
 	
-	void LabelBase::notifyEvent(chstr type, EventArgs* args)
+	void LabelBase::_notifyEvent(int typeId, EventArgs* args)
 	{
-		if (type == Event::LocalizationChanged)
+		switch (typeId)
 		{
+		case Event::LocalizationChangedId:
 			if (this->textKey != "")
 			{
 				this->setTextKey(this->textKey);
 				this->_autoScaleDirty = true;
 			}
-		}
-		else if (type == Event::TextChanged || type == Event::TextKeyChanged || type == Event::SizeChanged)
-		{
+			break;
+		case Event::TextChangedId:
+		case Event::TextKeyChangedId:
+		case Event::SizeChangedId:
 			this->_autoScaleDirty = true;
+			break;
 		}
 	}
 	
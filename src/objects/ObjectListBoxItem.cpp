@@ -95,10 +95,10 @@ namespace aprilui
 		Label::_update(timeDelta);
 	}
 
-	void ListBoxItem::notifyEvent(chstr type, EventArgs* args)
+	void ListBoxItem::_notifyEvent(int typeId, EventArgs* args)
 	{
-		Label::notifyEvent(type, args);
-		if (type == Event::AttachedToObject)
+		Label::_notifyEvent(typeId, args);
+		if (typeId == Event::AttachedToObjectId)
 		{
 			ListBox* listBox = dynamic_cast<ListBox*>(this->parent);
 			if (listBox != NULL)
@@ -164,6 +164,36 @@ namespace aprilui
 		return Label::triggerEvent(type, userData);
 	}
 
+	bool ListBoxItem::triggerEvent(int typeId, april::Key keyCode)
+	{
+		return Label::triggerEvent(typeId, keyCode);
+	}
+
+	bool ListBoxItem::triggerEvent(int typeId, april::Key keyCode, chstr string)
+	{
+		return Label::triggerEvent(typeId, keyCode, string);
+	}
+
+	bool ListBoxItem::triggerEvent(int typeId, april::Key keyCode, cgvec2f position, chstr string, void* userData)
+	{
+		return Label::triggerEvent(typeId, keyCode, position, string, userData);
+	}
+
+	bool ListBoxItem::triggerEvent(int typeId, april::Button buttonCode, chstr string, void* userData)
+	{
+		return Label::triggerEvent(typeId, buttonCode, string, userData);
+	}
+
+	bool ListBoxItem::triggerEvent(int typeId, chstr string, void* userData)
+	{
+		return Label::triggerEvent(typeId, string, userData);
+	}
+
+	bool ListBoxItem::triggerEvent(int typeId, void* userData)
+	{
+		return Label::triggerEvent(typeId, userData);
+	}
+
 	void ListBoxItem::_draw()
 	{
 		april::Color drawColor = this->_makeDrawColor();
@@ -213,7 +243,7 @@ namespace aprilui
 		bool result = ButtonBase::_mouseDown(keyCode);
 		if (result)
 		{
-			this->triggerEvent(Event::MouseDown, keyCode);
+			this->triggerEvent(Event::MouseDownId, keyCode);
 		}
 		return (result || Label::_mouseDown(keyCode));
 	}
@@ -224,12 +254,12 @@ namespace aprilui
 		bool up = false;
 		if (this->hovered)
 		{
-			up = this->triggerEvent(Event::MouseUp, keyCode);
+			up = this->triggerEvent(Event::MouseUpId, keyCode);
 		}
 		if (result)
 		{
 			this->_setSelected();
-			this->triggerEvent(Event::Click, keyCode);
+			this->triggerEvent(Event::ClickId, keyCode);
 		}
 		return (result || up || Label::_mouseUp(keyCode));
 	}
@@ -245,12 +275,17 @@ namespace aprilui
 		return (ButtonBase::_mouseMove() || Label::_mouseMove());
 	}
 
+	bool ListBoxItem::_isTrackingPointer() const
+	{
+		return (this->hovered || this->pushed);
+	}
+
 	bool ListBoxItem::_touchDown(int index)
 	{
 		bool result = ButtonBase::_touchDown(index);
 		if (result)
 		{
-			this->triggerEvent(Event::TouchDown, april::Key::None, hstr(index));
+			this->triggerEvent(Event::TouchDownId, april::Key::None, hstr(index));
 		}
 		return (result || Label::_touchDown(index));
 	}
@@ -262,10 +297,10 @@ namespace aprilui
 		bool up = false;
 		if (released)
 		{
-			up = this->triggerEvent(Event::TouchUp, april::Key::None, hstr(index));
+			up = this->triggerEvent(Event::TouchUpId, april::Key::None, hstr(index));
 			if (result)
 			{
-				this->triggerEvent(Event::Tap, april::Key::None, hstr(index));
+				this->triggerEvent(Event::TapId, april::Key::None, hstr(index));
 			}
 		}
 		return (result || up || Label::_touchUp(index));
@@ -287,7 +322,7 @@ namespace aprilui
 		bool result = ButtonBase::_buttonDown(buttonCode);
 		if (result)
 		{
-			this->triggerEvent(Event::ButtonDown, buttonCode);
+			this->triggerEvent(Event::ButtonDownId, buttonCode);
 		}
 		return (result || Label::_buttonDown(buttonCode));
 	}
@@ -302,12 +337,12 @@ namespace aprilui
 		bool up = false;
 		if (this->hovered)
 		{
-			up = this->triggerEvent(Event::ButtonUp, buttonCode);
+			up = this->triggerEvent(Event::ButtonUpId, buttonCode);
 		}
 		if (result)
 		{
 			this->_setSelected();
-			this->triggerEvent(Event::ButtonTrigger, buttonCode);
+			this->triggerEvent(Event::ButtonTriggerId, buttonCode);
 		}
 		return (result || up || Label::_buttonUp(buttonCode));
 	}
@@ -136,6 +136,24 @@ namespace aprilui
 		return ImageBox::getImageName();
 	}
 
+	void ProgressBar::setStretching(const bool& value)
+	{
+		if (this->stretching != value)
+		{
+			this->stretching = value;
+			this->_requestRedraw();
+		}
+	}
+
+	void ProgressBar::setDirection(const Direction& value)
+	{
+		if (this->direction != value)
+		{
+			this->direction = value;
+			this->_requestRedraw();
+		}
+	}
+
 	void ProgressBar::setImageByName(chstr name)
 	{
 		ImageBox::setImageByName(name);
@@ -165,7 +183,6 @@ namespace aprilui
 		ImageBox::_draw();
 		float progress = hclamp(this->progress, 0.0f, 1.0f);
 		grectf drawRect = this->_makeDrawRect();
-		grectf clipRect;
 		grectf sizeRect;
 		if (this->antiProgressImage != NULL && progress < 1.0f && this->direction.hasAntiProgress())
 		{
@@ -178,15 +195,12 @@ namespace aprilui
 			}
 			else
 			{
-				clipRect = (this->progressImage != NULL ? this->progressImage->getClipRect() : this->rect);
 				sizeRect.setSize(this->antiProgressImage->getSrcSize());
 				if (sizeRect.w <= 0.0f && sizeRect.h <= 0.0f)
 				{
 					sizeRect.setSize(drawRect.getSize());
 				}
-				this->antiProgressImage->setClipRect(this->_calcRectDirection(sizeRect, antiProgress, antiDirection));
-				this->antiProgressImage->draw(drawRect, drawAntiProgressColor);
-				this->antiProgressImage->setClipRect(clipRect);
+				this->antiProgressImage->drawClipped(drawRect, this->_calcRectDirection(sizeRect, antiProgress, antiDirection), drawAntiProgressColor);
 			}
 		}
 		if (this->progressImage != NULL && progress > 0.0f)
@@ -198,15 +212,12 @@ namespace aprilui
 			}
 			else
 			{
-				clipRect = this->progressImage->getClipRect();
 				sizeRect.setSize(this->progressImage->getSrcSize());
 				if (sizeRect.w <= 0.0f && sizeRect.h <= 0.0f)
 				{
 					sizeRect.setSize(drawRect.getSize());
 				}
-				this->progressImage->setClipRect(this->_calcRectDirection(sizeRect, progress, this->direction));
-				this->progressImage->draw(drawRect, drawProgressColor);
-				this->progressImage->setClipRect(clipRect);
+				this->progressImage->drawClipped(drawRect, this->_calcRectDirection(sizeRect, progress, this->direction), drawProgressColor);
 			}
 		}
 		if (this->maskImage != NULL)
@@ -292,7 +303,7 @@ namespace aprilui
 			this->pushed = true;
 			this->_updateInteractablePosition();
 			// TODO - will be removed once the hover refactor has been done
-			this->triggerEvent(Event::MouseDown, keyCode);
+			this->triggerEvent(Event::MouseDownId, keyCode);
 			return true;
 		}
 		return ImageBox::_mouseDown(keyCode);
@@ -303,7 +314,7 @@ namespace aprilui
 		if (this->interactable && this->pushed)
 		{
 			// TODO - will be removed once the hover refactor has been done
-			this->triggerEvent(Event::MouseUp, keyCode);
+			this->triggerEvent(Event::MouseUpId, keyCode);
 			if (this->isCursorInside())
 			{
 				this->pushed = false;
@@ -329,6 +340,11 @@ namespace aprilui
 		return ImageBox::_mouseMove();
 	}
 
+	bool ProgressBar::_isTrackingPointer() const
+	{
+		return (this->pushed || ImageBox::_isTrackingPointer());
+	}
+
 	void ProgressBar::_updateInteractablePosition()
 	{
 		gvec2f position = this->transformToLocalSpace(aprilui::getCursorPosition());
@@ -354,7 +370,7 @@ namespace aprilui
 		{
 			this->progress = newProgress;
 			this->progress = newProgress;
-			this->triggerEvent(Event::SetProgressValue);
+			this->triggerEvent(Event::SetProgressValueId);
 		}
 	}
 
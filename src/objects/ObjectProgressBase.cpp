@@ -13,6 +13,7 @@
 #include "BaseImage.h"
 #include "Dataset.h"
 #include "Image.h"
+#include "Object.h"
 #include "ObjectProgressBase.h"
 
 namespace aprilui
@@ -65,6 +66,42 @@ namespace aprilui
 		return ProgressBase::_propertyDescriptions;
 	}
 
+	void ProgressBase::setProgress(const float& value)
+	{
+		if (this->progress != value)
+		{
+			this->progress = value;
+			this->_requestProgressRedraw();
+		}
+	}
+
+	void ProgressBase::setProgressColor(const april::Color& value)
+	{
+		if (this->progressColor != value)
+		{
+			this->progressColor = value;
+			this->_requestProgressRedraw();
+		}
+	}
+
+	void ProgressBase::setAntiProgressColor(const april::Color& value)
+	{
+		if (this->antiProgressColor != value)
+		{
+			this->antiProgressColor = value;
+			this->_requestProgressRedraw();
+		}
+	}
+
+	void ProgressBase::setMaskColor(const april::Color& value)
+	{
+		if (this->maskColor != value)
+		{
+			this->maskColor = value;
+			this->_requestProgressRedraw();
+		}
+	}
+
 	void ProgressBase::setProgressImage(BaseImage* image)
 	{
 		this->progressImage = image;
@@ -137,6 +174,15 @@ namespace aprilui
 		return false;
 	}
 	
+	void ProgressBase::_requestProgressRedraw()
+	{
+		Dataset* dataset = this->getDataset();
+		if (dataset != NULL)
+		{
+			dataset->requestRedraw(dynamic_cast<Object*>(this));
+		}
+	}
+
 	void ProgressBase::setProgressSymbolicColor(chstr value)
 	{
 		this->setProgressColor(aprilui::_makeColor(value));
@@ -131,6 +131,15 @@ namespace aprilui
 		return ImageBox::getImageName();
 	}
 
+	void ProgressCircle::setDirection(const Direction& value)
+	{
+		if (this->direction != value)
+		{
+			this->direction = value;
+			this->_requestRedraw();
+		}
+	}
+
 	void ProgressCircle::setImageByName(chstr name)
 	{
 		ImageBox::setImageByName(name);
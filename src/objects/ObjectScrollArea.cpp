@@ -350,6 +350,11 @@ namespace aprilui
 		{
 			this->_dragTimer.set(0.0f, 0.0f);
 		}
+		// dragging, inertia and snapping continue in the next frames
+		if (this->pushed || this->dragging || this->isScrolling())
+		{
+			this->_requestUpdate();
+		}
 	}
 
 	void ScrollArea::_updateOobChildren()
@@ -486,29 +491,33 @@ namespace aprilui
 		return child;
 	}
 
-	void ScrollArea::notifyEvent(chstr type, EventArgs* args)
+	void ScrollArea::_notifyEvent(int typeId, EventArgs* args)
 	{
-		Object::notifyEvent(type, args);
-		if (type == Event::AttachedToObject)
+		Object::_notifyEvent(typeId, args);
+		switch (typeId)
 		{
-			Container* parent = dynamic_cast<Container*>(this->parent);
-			if (parent != NULL)
+		case Event::AttachedToObjectId:
 			{
-				parent->scrollArea = this;
+				Container* parent = dynamic_cast<Container*>(this->parent);
+				if (parent != NULL)
+				{
+					parent->scrollArea = this;
+				}
 			}
-		}
-		else if (type == Event::DetachedFromObject)
-		{
-			Container* parent = dynamic_cast<Container*>(this->parent);
-			if (parent != NULL)
+			break;
+		case Event::DetachedFromObjectId:
 			{
-				parent->scrollArea = NULL;
+				Container* parent = dynamic_cast<Container*>(this->parent);
+				if (parent != NULL)
+				{
+					parent->scrollArea = NULL;
+				}
 			}
-		}
-		else if (type == Event::SizeChanged)
-		{
+			break;
+		case Event::SizeChangedId:
 			this->snapScrollOffset();
 			this->_updateOobChildren();
+			break;
 		}
 	}
 
@@ -542,6 +551,36 @@ namespace aprilui
 		return Object::triggerEvent(type, userData);
 	}
 
+	bool ScrollArea::triggerEvent(int typeId, april::Key keyCode)
+	{
+		return Object::triggerEvent(typeId, keyCode);
+	}
+
+	bool ScrollArea::triggerEvent(int typeId, april::Key keyCode, chstr string)
+	{
+		return Object::triggerEvent(typeId, keyCode, string);
+	}
+
+	bool ScrollArea::triggerEvent(int typeId, april::Key keyCode, cgvec2f position, chstr string, void* userData)
+	{
+		return Object::triggerEvent(typeId, keyCode, position, string, userData);
+	}
+
+	bool ScrollArea::triggerEvent(int typeId, april::Button buttonCode, chstr string, void* userData)
+	{
+		return Object::triggerEvent(typeId, buttonCode, string, userData);
+	}
+
+	bool ScrollArea::triggerEvent(int typeId, chstr string, void* userData)
+	{
+		return Object::triggerEvent(typeId, string, userData);
+	}
+
+	bool ScrollArea::triggerEvent(int typeId, void* userData)
+	{
+		return Object::triggerEvent(typeId, userData);
+	}
+
 	bool ScrollArea::onMouseDown(april::Key keyCode)
 	{
 		// has to override its children which is why onMouseDown() is overriden and not _mouseDown()
@@ -620,6 +659,11 @@ namespace aprilui
 		return Object::_mouseMove();
 	}
 
+	bool ScrollArea::_isTrackingPointer() const
+	{
+		return (this->hovered || this->pushed);
+	}
+
 	bool ScrollArea::_buttonDown(april::Button buttonCode)
 	{
 		return (ButtonBase::_buttonDown(buttonCode) || Object::_buttonDown(buttonCode));
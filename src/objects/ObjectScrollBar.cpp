@@ -139,7 +139,7 @@ namespace aprilui
 		if (this->skinName != value)
 		{
 			this->skinName = value;
-			this->notifyEvent(Event::ScrollSkinChanged, NULL);
+			this->notifyEvent(Event::ScrollSkinChangedId, NULL);
 		}
 	}
 
@@ -269,6 +269,15 @@ namespace aprilui
 			if (parent != NULL && parent->scrollArea != NULL && this->_retainTime > 0.0f)
 			{
 				this->_retainTime -= timeDelta;
+				if (this->useFading)
+				{
+					this->_requestRedraw();
+				}
+				// the bar keeps fading out until the retain time runs out
+				if (this->_retainTime > 0.0f)
+				{
+					this->_requestUpdate();
+				}
 			}
 		}
 	}
@@ -318,19 +327,21 @@ namespace aprilui
 		}
 	}
 
-	void ScrollBar::notifyEvent(chstr type, EventArgs* args)
+	void ScrollBar::_notifyEvent(int typeId, EventArgs* args)
 	{
-		Object::notifyEvent(type, args);
-		if (type == Event::AttachedToObject)
+		Object::_notifyEvent(typeId, args);
+		switch (typeId)
 		{
-			Container* parent = dynamic_cast<Container*>(this->parent);
-			if (parent == NULL)
+		case Event::AttachedToObjectId:
 			{
-				hlog::warnf(logTag, "ScrollBar '%s' not attached to object of class Container!", this->name.cStr());
+				Container* parent = dynamic_cast<Container*>(this->parent);
+				if (parent == NULL)
+				{
+					hlog::warnf(logTag, "ScrollBar '%s' not attached to object of class Container!", this->name.cStr());
+				}
 			}
-		}
-		else if (type == Event::ScrollSkinChanged)
-		{
+			break;
+		case Event::ScrollSkinChangedId:
 			if (this->skinName != "")
 			{
 				this->_updateButtonBackgroundSkinned();
@@ -367,6 +378,7 @@ namespace aprilui
 					this->_buttonBackwardSkinned = NULL;
 				}
 			}
+			break;
 		}
 	}
 
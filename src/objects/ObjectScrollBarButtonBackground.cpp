@@ -35,24 +35,29 @@ namespace aprilui
 		return new ScrollBarButtonBackground(name);
 	}
 
-	void ScrollBarButtonBackground::notifyEvent(chstr type, EventArgs* args)
+	void ScrollBarButtonBackground::_notifyEvent(int typeId, EventArgs* args)
 	{
-		ImageButton::notifyEvent(type, args);
-		if (type == Event::AttachedToObject)
+		ImageButton::_notifyEvent(typeId, args);
+		switch (typeId)
 		{
-			ScrollBar* parent = dynamic_cast<ScrollBar*>(this->parent);
-			if (parent != NULL)
+		case Event::AttachedToObjectId:
 			{
-				parent->_setButtonBackground(this);
+				ScrollBar* parent = dynamic_cast<ScrollBar*>(this->parent);
+				if (parent != NULL)
+				{
+					parent->_setButtonBackground(this);
+				}
 			}
-		}
-		else if (type == Event::DetachedFromObject)
-		{
-			ScrollBar* parent = dynamic_cast<ScrollBar*>(this->parent);
-			if (parent != NULL)
+			break;
+		case Event::DetachedFromObjectId:
 			{
-				parent->_unsetButtonBackground(this);
+				ScrollBar* parent = dynamic_cast<ScrollBar*>(this->parent);
+				if (parent != NULL)
+				{
+					parent->_unsetButtonBackground(this);
+				}
 			}
+			break;
 		}
 	}
 
@@ -35,24 +35,29 @@ namespace aprilui
 		return new ScrollBarButtonBackward(name);
 	}
 
-	void ScrollBarButtonBackward::notifyEvent(chstr type, EventArgs* args)
+	void ScrollBarButtonBackward::_notifyEvent(int typeId, EventArgs* args)
 	{
-		ImageButton::notifyEvent(type, args);
-		if (type == Event::AttachedToObject)
+		ImageButton::_notifyEvent(typeId, args);
+		switch (typeId)
 		{
-			ScrollBar* parent = dynamic_cast<ScrollBar*>(this->parent);
-			if (parent != NULL)
+		case Event::AttachedToObjectId:
 			{
-				parent->_setButtonBackward(this);
+				ScrollBar* parent = dynamic_cast<ScrollBar*>(this->parent);
+				if (parent != NULL)
+				{
+					parent->_setButtonBackward(this);
+				}
 			}
-		}
-		else if (type == Event::DetachedFromObject)
-		{
-			ScrollBar* parent = dynamic_cast<ScrollBar*>(this->parent);
-			if (parent != NULL)
+			break;
+		case Event::DetachedFromObjectId:
 			{
-				parent->_unsetButtonBackward(this);
+				ScrollBar* parent = dynamic_cast<ScrollBar*>(this->parent);
+				if (parent != NULL)
+				{
+					parent->_unsetButtonBackward(this);
+				}
 			}
+			break;
 		}
 	}
 
@@ -35,24 +35,29 @@ namespace aprilui
 		return new ScrollBarButtonForward(name);
 	}
 
-	void ScrollBarButtonForward::notifyEvent(chstr type, EventArgs* args)
+	void ScrollBarButtonForward::_notifyEvent(int typeId, EventArgs* args)
 	{
-		ImageButton::notifyEvent(type, args);
-		if (type == Event::AttachedToObject)
+		ImageButton::_notifyEvent(typeId, args);
+		switch (typeId)
 		{
-			ScrollBar* parent = dynamic_cast<ScrollBar*>(this->parent);
-			if (parent != NULL)
+		case Event::AttachedToObjectId:
 			{
-				parent->_setButtonForward(this);
+				ScrollBar* parent = dynamic_cast<ScrollBar*>(this->parent);
+				if (parent != NULL)
+				{
+					parent->_setButtonForward(this);
+				}
 			}
-		}
-		else if (type == Event::DetachedFromObject)
-		{
-			ScrollBar* parent = dynamic_cast<ScrollBar*>(this->parent);
-			if (parent != NULL)
+			break;
+		case Event::DetachedFromObjectId:
 			{
-				parent->_unsetButtonForward(this);
+				ScrollBar* parent = dynamic_cast<ScrollBar*>(this->parent);
+				if (parent != NULL)
+				{
+					parent->_unsetButtonForward(this);
+				}
 			}
+			break;
 		}
 	}
 
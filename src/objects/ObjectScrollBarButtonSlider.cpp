@@ -36,24 +36,29 @@ namespace aprilui
 		return new ScrollBarButtonSlider(name);
 	}
 
-	void ScrollBarButtonSlider::notifyEvent(chstr type, EventArgs* args)
+	void ScrollBarButtonSlider::_notifyEvent(int typeId, EventArgs* args)
 	{
-		ImageButton::notifyEvent(type, args);
-		if (type == Event::AttachedToObject)
+		ImageButton::_notifyEvent(typeId, args);
+		switch (typeId)
 		{
-			ScrollBar* parent = dynamic_cast<ScrollBar*>(this->parent);
-			if (parent != NULL)
+		case Event::AttachedToObjectId:
 			{
-				parent->_setButtonSlider(this);
+				ScrollBar* parent = dynamic_cast<ScrollBar*>(this->parent);
+				if (parent != NULL)
+				{
+					parent->_setButtonSlider(this);
+				}
 			}
-		}
-		else if (type == Event::DetachedFromObject)
-		{
-			ScrollBar* parent = dynamic_cast<ScrollBar*>(this->parent);
-			if (parent != NULL)
+			break;
+		case Event::DetachedFromObjectId:
 			{
-				parent->_unsetButtonSlider(this);
+				ScrollBar* parent = dynamic_cast<ScrollBar*>(this->parent);
+				if (parent != NULL)
+				{
+					parent->_unsetButtonSlider(this);
+				}
 			}
+			break;
 		}
 	}
 
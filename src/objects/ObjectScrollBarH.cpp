@@ -143,24 +143,29 @@ namespace aprilui
 		return hroundf(x * this->scrollDistance);
 	}
 
-	void ScrollBarH::notifyEvent(chstr type, EventArgs* args)
+	void ScrollBarH::_notifyEvent(int typeId, EventArgs* args)
 	{
-		ScrollBar::notifyEvent(type, args);
-		if (type == Event::AttachedToObject)
+		ScrollBar::_notifyEvent(typeId, args);
+		switch (typeId)
 		{
-			Container* parent = dynamic_cast<Container*>(this->parent);
-			if (parent != NULL)
+		case Event::AttachedToObjectId:
 			{
-				parent->scrollBarH =this;
+				Container* parent = dynamic_cast<Container*>(this->parent);
+				if (parent != NULL)
+				{
+					parent->scrollBarH =this;
+				}
 			}
-		}
-		else if (type == Event::DetachedFromObject)
-		{
-			Container* parent = dynamic_cast<Container*>(this->parent);
-			if (parent != NULL)
+			break;
+		case Event::DetachedFromObjectId:
 			{
-				parent->scrollBarH = NULL;
+				Container* parent = dynamic_cast<Container*>(this->parent);
+				if (parent != NULL)
+				{
+					parent->scrollBarH = NULL;
+				}
 			}
+			break;
 		}
 	}
 
@@ -143,24 +143,29 @@ namespace aprilui
 		return hroundf(y * this->scrollDistance);
 	}
 
-	void ScrollBarV::notifyEvent(chstr type, EventArgs* args)
+	void ScrollBarV::_notifyEvent(int typeId, EventArgs* args)
 	{
-		ScrollBar::notifyEvent(type, args);
-		if (type == Event::AttachedToObject)
+		ScrollBar::_notifyEvent(typeId, args);
+		switch (typeId)
 		{
-			Container* parent = dynamic_cast<Container*>(this->parent);
-			if (parent != NULL)
+		case Event::AttachedToObjectId:
 			{
-				parent->scrollBarV = this;
+				Container* parent = dynamic_cast<Container*>(this->parent);
+				if (parent != NULL)
+				{
+					parent->scrollBarV = this;
+				}
 			}
-		}
-		else if (type == Event::DetachedFromObject)
-		{
-			Container* parent = dynamic_cast<Container*>(this->parent);
-			if (parent != NULL)
+			break;
+		case Event::DetachedFromObjectId:
 			{
-				parent->scrollBarV = NULL;
+				Container* parent = dynamic_cast<Container*>(this->parent);
+				if (parent != NULL)
+				{
+					parent->scrollBarV = NULL;
+				}
 			}
+			break;
 		}
 	}
 
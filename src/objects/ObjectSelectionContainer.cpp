@@ -113,7 +113,7 @@ namespace aprilui
 			{
 				this->_updateItem(oldIndex);
 				this->_updateItem(this->selectedIndex);
-				this->triggerEvent(Event::SelectedChanged, hstr(this->selectedIndex));
+				this->triggerEvent(Event::SelectedChangedId, hstr(this->selectedIndex));
 			}
 		}
 	}
@@ -209,10 +209,10 @@ namespace aprilui
 		}
 	}
 
-	void SelectionContainer::notifyEvent(chstr type, EventArgs* args)
+	void SelectionContainer::_notifyEvent(int typeId, EventArgs* args)
 	{
-		Container::notifyEvent(type, args);
-		if (type == Event::RegisteredInDataset)
+		Container::_notifyEvent(typeId, args);
+		if (typeId == Event::RegisteredInDatasetId)
 		{
 			if (this->scrollArea == NULL)
 			{
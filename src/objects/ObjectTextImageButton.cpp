@@ -14,6 +14,7 @@
 #include "aprilui.h"
 #include "apriluiUtil.h"
 #include "Dataset.h"
+#include "Event.h"
 #include "ObjectLabelBase.h"
 #include "ObjectTextImageButton.h"
 
@@ -28,6 +29,7 @@ namespace aprilui
 		LabelBase()
 	{
 		this->text = "TextImageButton: " + name;
+		this->subscribeBroadcast(Event::LocalizationChanged);
 		this->hoverTextColor = april::Color::Grey;
 		this->pushedTextColor = april::Color::White * 0.2f;
 		this->disabledTextColor = april::Color::Grey;
@@ -100,6 +102,11 @@ namespace aprilui
 		return this->autoScaledFont;
 	}
 
+	int64_t TextImageButton::getByteSize() const
+	{
+		return (ImageButton::getByteSize() + LabelBase::getByteSize() + (int64_t)(sizeof(TextImageButton) - sizeof(Object) - sizeof(LabelBase)));
+	}
+
 	void TextImageButton::setHoverTextColor(const april::Color& value)
 	{
 		this->hoverTextColor = value;
@@ -193,6 +200,12 @@ namespace aprilui
 		this->backgroundColor = backgroundColor;
 		this->textColor = textColor;
 	}
+
+	grectf TextImageButton::_makeDrawBounds()
+	{
+		this->_textDrawBounds = this->_makeTextDrawBounds(ImageButton::_makeDrawBounds());
+		return this->_textDrawBounds;
+	}
 	
 	hstr TextImageButton::getProperty(chstr name)
 	{
@@ -213,10 +226,10 @@ namespace aprilui
 		return ImageButton::setProperty(name, value);
 	}
 
-	void TextImageButton::notifyEvent(chstr type, EventArgs* args)
+	void TextImageButton::_notifyEvent(int typeId, EventArgs* args)
 	{
-		ImageButton::notifyEvent(type, args);
-		LabelBase::notifyEvent(type, args);
+		ImageButton::_notifyEvent(typeId, args);
+		LabelBase::_notifyEvent(typeId, args);
 	}
 
 	bool TextImageButton::triggerEvent(chstr type, april::Key keyCode)
@@ -249,4 +262,34 @@ namespace aprilui
 		return ImageButton::triggerEvent(type, userData);
 	}
 
+	bool TextImageButton::triggerEvent(int typeId, april::Key keyCode)
+	{
+		return ImageButton::triggerEvent(typeId, keyCode);
+	}
+
+	bool TextImageButton::triggerEvent(int typeId, april::Key keyCode, chstr string)
+	{
+		return ImageButton::triggerEvent(typeId, keyCode, string);
+	}
+
+	bool TextImageButton::triggerEvent(int typeId, april::Key keyCode, cgvec2f position, chstr string, void* userData)
+	{
+		return ImageButton::triggerEvent(typeId, keyCode, position, string, userData);
+	}
+
+	bool TextImageButton::triggerEvent(int typeId, april::Button buttonCode, chstr string, void* userData)
+	{
+		return ImageButton::triggerEvent(typeId, buttonCode, string, userData);
+	}
+
+	bool TextImageButton::triggerEvent(int typeId, chstr string, void* userData)
+	{
+		return ImageButton::triggerEvent(typeId, string, userData);
+	}
+
+	bool TextImageButton::triggerEvent(int typeId, void* userData)
+	{
+		return ImageButton::triggerEvent(typeId, userData);
+	}
+
 }
@@ -99,6 +99,15 @@ namespace aprilui
 		return ToggleButton::_setters;
 	}
 
+	void ToggleButton::setToggled(const bool& value)
+	{
+		if (this->toggled != value)
+		{
+			this->toggled = value;
+			this->_requestRedraw();
+		}
+	}
+
 	void ToggleButton::setToggledNormalImage(BaseImage* image)
 	{
 		this->toggledNormalImage = image;
@@ -200,12 +209,12 @@ namespace aprilui
 
 	void ToggleButton::turnOn()
 	{
-		this->toggled = true;
+		this->setToggled(true);
 	}
 
 	void ToggleButton::turnOff()
 	{
-		this->toggled = false;
+		this->setToggled(false);
 	}
 		
 	void ToggleButton::_draw()
@@ -38,10 +38,10 @@ namespace aprilui
 		return new TreeViewExpander(name);
 	}
 
-	void TreeViewExpander::notifyEvent(chstr type, EventArgs* args)
+	void TreeViewExpander::_notifyEvent(int typeId, EventArgs* args)
 	{
-		ToggleButton::notifyEvent(type, args);
-		if (type == Event::AttachedToObject)
+		ToggleButton::_notifyEvent(typeId, args);
+		if (typeId == Event::AttachedToObjectId)
 		{
 			TreeViewNode* treeViewNode = dynamic_cast<TreeViewNode*>(this->parent);
 			if (treeViewNode != NULL)
@@ -76,7 +76,7 @@ namespace aprilui
 	{
 		if (this->_treeView != NULL)
 		{
-			this->triggerEvent(this->toggled ? Event::NodeExpanded : Event::NodeCollapsed, this->_treeViewNode->name);
+			this->triggerEvent(this->toggled ? Event::NodeExpandedId : Event::NodeCollapsedId, this->_treeViewNode->name);
 			this->_treeView->_updateDisplay();
 		}
 	}
@@ -36,10 +36,10 @@ namespace aprilui
 		return new TreeViewImage(name);
 	}
 
-	void TreeViewImage::notifyEvent(chstr type, EventArgs* args)
+	void TreeViewImage::_notifyEvent(int typeId, EventArgs* args)
 	{
-		ImageBox::notifyEvent(type, args);
-		if (type == Event::AttachedToObject)
+		ImageBox::_notifyEvent(typeId, args);
+		if (typeId == Event::AttachedToObjectId)
 		{
 			TreeViewNode* treeViewNode = dynamic_cast<TreeViewNode*>(this->parent);
 			if (treeViewNode != NULL)
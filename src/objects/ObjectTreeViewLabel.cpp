@@ -36,10 +36,10 @@ namespace aprilui
 		return new TreeViewLabel(name);
 	}
 
-	void TreeViewLabel::notifyEvent(chstr type, EventArgs* args)
+	void TreeViewLabel::_notifyEvent(int typeId, EventArgs* args)
 	{
-		Label::notifyEvent(type, args);
-		if (type == Event::AttachedToObject)
+		Label::_notifyEvent(typeId, args);
+		if (typeId == Event::AttachedToObjectId)
 		{
 			TreeViewNode* treeViewNode = dynamic_cast<TreeViewNode*>(this->parent);
 			if (treeViewNode != NULL)
@@ -204,10 +204,10 @@ namespace aprilui
 		return offset;
 	}
 
-	void TreeViewNode::notifyEvent(chstr type, EventArgs* args)
+	void TreeViewNode::_notifyEvent(int typeId, EventArgs* args)
 	{
-		Container::notifyEvent(type, args);
-		if (type == Event::AttachedToObject)
+		Container::_notifyEvent(typeId, args);
+		if (typeId == Event::AttachedToObjectId)
 		{
 			bool found = false;
 			TreeView* treeView = dynamic_cast<TreeView*>(this->parent);
@@ -298,6 +298,36 @@ namespace aprilui
 		return Container::triggerEvent(type, userData);
 	}
 
+	bool TreeViewNode::triggerEvent(int typeId, april::Key keyCode)
+	{
+		return Container::triggerEvent(typeId, keyCode);
+	}
+
+	bool TreeViewNode::triggerEvent(int typeId, april::Key keyCode, chstr string)
+	{
+		return Container::triggerEvent(typeId, keyCode, string);
+	}
+
+	bool TreeViewNode::triggerEvent(int typeId, april::Key keyCode, cgvec2f position, chstr string, void* userData)
+	{
+		return Container::triggerEvent(typeId, keyCode, position, string, userData);
+	}
+
+	bool TreeViewNode::triggerEvent(int typeId, april::Button buttonCode, chstr string, void* userData)
+	{
+		return Container::triggerEvent(typeId, buttonCode, string, userData);
+	}
+
+	bool TreeViewNode::triggerEvent(int typeId, chstr string, void* userData)
+	{
+		return Container::triggerEvent(typeId, string, userData);
+	}
+
+	bool TreeViewNode::triggerEvent(int typeId, void* userData)
+	{
+		return Container::triggerEvent(typeId, userData);
+	}
+
 	april::Color TreeViewNode::_getCurrentBackgroundColor() const
 	{
 		if (this->_treeView != NULL)
@@ -331,7 +361,7 @@ namespace aprilui
 		bool result = ButtonBase::_mouseDown(keyCode);
 		if (result)
 		{
-			this->triggerEvent(Event::MouseDown, keyCode);
+			this->triggerEvent(Event::MouseDownId, keyCode);
 		}
 		return (result || Container::_mouseDown(keyCode));
 	}
@@ -342,12 +372,12 @@ namespace aprilui
 		bool up = false;
 		if (this->hovered)
 		{
-			up = this->triggerEvent(Event::MouseUp, keyCode);
+			up = this->triggerEvent(Event::MouseUpId, keyCode);
 		}
 		if (result)
 		{
 			this->_setSelected();
-			this->triggerEvent(Event::Click, keyCode);
+			this->triggerEvent(Event::ClickId, keyCode);
 		}
 		return (result || up || Container::_mouseUp(keyCode));
 	}
@@ -363,12 +393,17 @@ namespace aprilui
 		return (ButtonBase::_mouseMove() || Container::_mouseMove());
 	}
 
+	bool TreeViewNode::_isTrackingPointer() const
+	{
+		return (this->hovered || this->pushed);
+	}
+
 	bool TreeViewNode::_touchDown(int index)
 	{
 		bool result = ButtonBase::_touchDown(index);
 		if (result)
 		{
-			this->triggerEvent(Event::TouchDown, april::Key::None, hstr(index));
+			this->triggerEvent(Event::TouchDownId, april::Key::None, hstr(index));
 		}
 		return (result || Container::_touchDown(index));
 	}
@@ -380,10 +415,10 @@ namespace aprilui
 		bool up = false;
 		if (released)
 		{
-			up = this->triggerEvent(Event::TouchUp, april::Key::None, hstr(index));
+			up = this->triggerEvent(Event::TouchUpId, april::Key::None, hstr(index));
 			if (result)
 			{
-				this->triggerEvent(Event::Tap, april::Key::None, hstr(index));
+				this->triggerEvent(Event::TapId, april::Key::None, hstr(index));
 			}
 		}
 		return (result || up || Container::_touchUp(index));
@@ -405,7 +440,7 @@ namespace aprilui
 		bool result = ButtonBase::_buttonDown(buttonCode);
 		if (result)
 		{
-			this->triggerEvent(Event::ButtonDown, buttonCode);
+			this->triggerEvent(Event::ButtonDownId, buttonCode);
 		}
 		return (result || Container::_buttonDown(buttonCode));
 	}
@@ -420,12 +455,12 @@ namespace aprilui
 		bool up = false;
 		if (this->hovered)
 		{
-			up = this->triggerEvent(Event::ButtonUp, buttonCode);
+			up = this->triggerEvent(Event::ButtonUpId, buttonCode);
 		}
 		if (result)
 		{
 			this->_setSelected();
-			this->triggerEvent(Event::ButtonTrigger, buttonCode);
+			this->triggerEvent(Event::ButtonTriggerId, buttonCode);
 		}
 		return (result || up || Container::_buttonUp(buttonCode));
 	}